@@ -70,6 +70,8 @@ public:
     virtual void op2( uint16_t op, const T *  opnd1, const FLT&opnd2 );
     virtual void op3( uint16_t op, const T *  opnd1, const T * opnd2, const T * opnd3 );
     virtual void op4( uint16_t op, const T *  opnd1, const T * opnd2, const T * opnd3, const T * opnd4 );
+    virtual void iterations_skipped( const void * cordic, uint32_t cnt );
+    virtual void memo_lookup( const void * cordic, uint16_t op, bool hit );
 
     using OP                         = typename Cordic<T,FLT>::OP;
     static constexpr uint64_t OP_cnt = Cordic<T,FLT>::OP_cnt;
@@ -151,6 +153,8 @@ private:
         op1f, 
         op2i, 
         op2f, 
+        iterations_skipped,
+        memo_lookup,
     };
 
     std::mutex                                  lock;                   // to make this thread-safe
@@ -252,6 +256,8 @@ Analysis<T,FLT>::Analysis( std::string _base_name ) : Logger<T,FLT>( Cordic<T,FL
     kinds["op2f"]               = KIND::op2f;
     kinds["op3"]                = KIND::op3;
     kinds["op4"]                = KIND::op4;
+    kinds["iterations_skipped"] = KIND::iterations_skipped;
+    kinds["memo_lookup"]        = KIND::memo_lookup;
 
     for( uint32_t t = 0; t < THREAD_CNT_MAX; t++ )
     {
@@ -553,6 +559,21 @@ inline void Analysis<T,FLT>::op4( uint16_t _op, const T * opnd1, const T * opnd2
     op( _op, 4, opnds );
 }
 
+template< typename T, typename FLT >
+inline void Analysis<T,FLT>::iterations_skipped( const void * cordic, uint32_t cnt )
+{
+    (void)cordic;
+    this->iterations_skipped_count( cnt );
+}
+
+template< typename T, typename FLT >
+inline void Analysis<T,FLT>::memo_lookup( const void * cordic, uint16_t _op, bool hit )
+{
+    (void)cordic;
+    (void)_op;
+    this->memo_lookup_count( hit );
+}
+
 //-----------------------------------------------------
 // Parsing Stuff
 //-----------------------------------------------------
@@ -613,6 +634,8 @@ inline typename Analysis<T,FLT>::KIND Analysis<T,FLT>::parse_kind( char *& c )
     if ( name == "op2f" )               return KIND::op2f;
     if ( name == "op3" )                return KIND::op3;
     if ( name == "op4" )                return KIND::op4;
+    if ( name == "iterations_skipped" ) return KIND::iterations_skipped;
+    if ( name == "memo_lookup" )        return KIND::memo_lookup;
     return KIND(-1);
 }
 
@@ -849,6 +872,23 @@ void Analysis<T,FLT>::parse( void )
                 break;
             }
 
+            case KIND::iterations_skipped:
+            {
+                const void * cordic = parse_addr( c );
+                uint32_t     cnt    = parse_int( c );
+                iterations_skipped( cordic, cnt );
+                break;
+            }
+
+            case KIND::memo_lookup:
+            {
+                const void * cordic = parse_addr( c );
+                std::string  name   = parse_name( c );
+                bool         hit    = parse_int( c ) != 0;
+                memo_lookup( cordic, uint16_t(ops[name]), hit );
+                break;
+            }
+
             default:
             {
                 continue;
@@ -996,6 +1036,8 @@ void Analysis<T,FLT>::print_stats( std::string basename, double scale_factor,
         }
     }
 
+    this->print_counts( out, csv );
+
     fclose( out );
     csv.close();
     std::cout << "\nWrote stats to " + basename + ".{out,csv}\n";
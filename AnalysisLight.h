@@ -66,6 +66,8 @@ public:
     virtual void op2( uint16_t op, const T *  opnd1, const FLT&opnd2 );
     virtual void op3( uint16_t op, const T *  opnd1, const T * opnd2, const T * opnd3 );
     virtual void op4( uint16_t op, const T *  opnd1, const T * opnd2, const T * opnd3, const T * opnd4 );
+    virtual void iterations_skipped( const void * cordic, uint32_t cnt );
+    virtual void memo_lookup( const void * cordic, uint16_t op, bool hit );
 
     using OP                         = typename Cordic<T,FLT>::OP;
     static constexpr uint64_t OP_cnt = Cordic<T,FLT>::OP_cnt;
@@ -288,6 +290,21 @@ inline void AnalysisLight<T,FLT>::op4( uint16_t _op, const T * opnd1, const T *
     op_cnt[tid][stack_top()][_op]++;
 }
 
+template< typename T, typename FLT >
+inline void AnalysisLight<T,FLT>::iterations_skipped( const void * cordic, uint32_t cnt )
+{
+    (void)cordic;
+    this->iterations_skipped_count( cnt );
+}
+
+template< typename T, typename FLT >
+inline void AnalysisLight<T,FLT>::memo_lookup( const void * cordic, uint16_t _op, bool hit )
+{
+    (void)cordic;
+    (void)_op;
+    this->memo_lookup_count( hit );
+}
+
 template< typename T, typename FLT >
 inline void AnalysisLight<T,FLT>::inc_op_cnt( OP _op, uint32_t by )
 {
@@ -381,6 +398,8 @@ void AnalysisLight<T,FLT>::print_stats( std::string basename, double scale_facto
         csv << "\"" << Cordic<T,FLT>::op_to_str( i ) << "\", " << cnt << ", " << scaled_cnt << "\n";
     }
 
+    this->print_counts( out, csv );
+
     fclose( out );
     csv.close();
     std::cout << "\nWrote stats to " + basename + ".{out,csv}\n";
@@ -25,7 +25,17 @@
 #include <cfenv>
 #include <iostream>
 #include <iomanip>
+#include <atomic>
 #include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Logger.h"
 
@@ -41,18 +51,25 @@ static constexpr bool do_asserts = false;
 static constexpr bool do_asserts = true;
 #endif
 
+#ifdef CORDIC_BRANCHLESS
+static constexpr bool branchless = true;        // core loops pick directions using sign masks instead of branches
+#else
+static constexpr bool branchless = false;
+#endif
+
 #define cassert(expr, msg) if ( do_asserts && !(expr) ) \
                 { std::cout << "ERROR: assertion failure: " << (msg) << " at " << __FILE__ << ":" << __LINE__ << "\n"; exit( 1 ); }
 
 // extended rounding modes beyond FE_TONEAREST etc.
 //
 static constexpr int FE_NOROUND      = 0x1000;  // perform no rounding at all; leave guard bits alone
-static constexpr int FE_AWAYFROMZERO = 0x2000;  // signbit(x) ? trunc(x) : ceil(x);   and clear guard bits
+static constexpr int FE_AWAYFROMZERO = 0x2000;  // signbit(x) ? floor(x) : ceil(x);   and clear guard bits
 
 // T      = some signed integer type that can hold fixed-point values (default is int64_t)
 // FLT    = some floating-point type that can hold constants of the desired precision (default is double)
+// CORE   = void (default), or a subclass that supplies unrolled core routines, as in StaticCordic.h
 //
-template< typename T=int64_t, typename FLT=double >              
+template< typename T=int64_t, typename FLT=double, typename CORE=void >              
 class Cordic
 {
 public:
@@ -76,6 +93,81 @@ public:
     
     void log_constructed( void );               // for when Cordic constructed before logging enabled
 
+    //-----------------------------------------------------
+    // Modes
+    //
+    // These change how the core CORDIC routines below do their work.
+    // The defaults give the classic radix-2 CORDIC.
+    //-----------------------------------------------------
+    void     radix_set( uint32_t radix );       // 2 (default) or 4; radix 4 picks digits from {-2,-1,0,1,2} and needs about half the iterations
+    uint32_t radix( void ) const;               // current radix
+    void     lut_prefix_set( uint32_t k );      // 0 (default) or 1..16: circular/hyperbolic rotation start with a 2^k-entry table lookup on the top k bits of z0,
+                                                //                        which replaces the first ~k iterations (radix 2 only)
+    uint32_t lut_prefix( void ) const;          // current k
+    void     linear_finish_set( bool en );      // false (default) or true: after about half the iterations the residual angle is small enough that
+                                                //                          one linear step (rotation) or one y/x divide (vectoring) finishes the job (radix 2 only)
+    bool     linear_finish( void ) const;       // current setting
+    void     hyperbolic_neg_iter_set( uint32_t k ); // 0 (default) or 1..8: hyperbolic_rotation() adds k leading iterations i = 1-k .. 0 that use
+                                                //                        1-2^(i-2) in place of 2^-i, which extends |z0| from 1.118 to about 2.1, 3.4, 5.1, 7.2, ...;
+                                                //                        exp() and sinh()/cosh()/tanh() then skip their argument reduction in that range
+    uint32_t hyperbolic_neg_iter( void ) const; // current k
+    void     small_angle_skip_set( bool en );   // false (default) or true: when |z0| (rotation) or |y0/x0| (vectoring) is below 2^-s, 
+                                                //                          start at iteration s and apply the gain of iterations 0..s-1 from a table
+                                                //                          (radix 2 only, not with lut_prefix)
+    bool     small_angle_skip( void ) const;    // current setting
+    void     early_exit_set( bool en );         // false (default) or true: stop once vectoring y or rotation z is exactly 0, 
+                                                //                          applying the gain of the remaining iterations from a table (radix 2 only);
+                                                //                          the logger's iterations_skipped() gets the number of iterations saved
+    bool     early_exit( void ) const;          // current setting
+    bool     modes_are_default( void ) const;   // true if all of the above are at their defaults
+
+    void     native_muldiv_set( bool en );      // false (default) or true: mul/div/fma/fda/sqr/rcp multiply or divide the mantissas
+                                                //                          using host integer ops instead of linear_rotation()/linear_vectoring();
+                                                //                          rounding is unchanged, and the core routines above are not affected
+    bool     native_muldiv( void ) const;       // current setting
+
+    enum class DIV_ENGINE
+    {
+        CORDIC,                                 // linear_vectoring() for div, hyperbolic_vectoring() for sqrt (default)
+        SRT4,                                   // radix-4 SRT digit recurrence with digits {-2..2}, 2 quotient/root bits per step
+        NEWTON,                                 // Newton-Raphson from a 256-entry seed table, then an exact remainder fix-up
+        GOLDSCHMIDT,                            // Goldschmidt from the same seed table, then an exact remainder fix-up (rsqrt() also uses Goldschmidt)
+    };
+    void       div_engine_set( DIV_ENGINE e );  // engine for div/rcp/fda (mantissa divide) and sqrt; floating-point only;
+                                                // native_muldiv_set(true) takes precedence for div
+    DIV_ENGINE div_engine( void ) const;        // current engine
+    uint32_t   div_engine_steps( void ) const;  // serial steps for one mantissa divide: iterations for CORDIC and SRT4,
+                                                // dependent multiplies for NEWTON and GOLDSCHMIDT plus 2 for their remainder
+                                                // fix-up (the q*x multiply and the remainder check/correction)
+    uint32_t   div_engine_sqrt_steps( void ) const; // same for one mantissa sqrt: hyperbolic iterations (with repeats) plus
+                                                // the gain multiply for CORDIC, iterations for SRT4, and the rsqrt multiplies
+                                                // plus a*r and the 2-step fix-up for NEWTON and GOLDSCHMIDT
+    static std::string to_str( DIV_ENGINE e );  // "CORDIC", "SRT4", "NEWTON", "GOLDSCHMIDT"
+
+    //-----------------------------------------------------
+    // Constant Multipliers
+    //
+    // mulc() multiplies by a known constant using only the non-zero digits of the
+    // canonical-signed-digit (CSD) recoding of the constant's mantissa, about n/3 shifts and adds.
+    // The constants used internally are recoded once per format and shared.  For other constants,
+    // make a ConstMultiplier once and pass it to mulc().
+    //-----------------------------------------------------
+    struct ConstMultiplier
+    {
+        struct Digit
+        {
+            int32_t             shift;          // mantissa >> shift  (-1 means mantissa << 1)
+            bool                is_neg;         // subtract instead of add
+        };
+        T                       c;              // encoded constant
+        bool                    is_normal;      // false for 0, inf, nan; mulc() then calls mul()
+        bool                    sign;           // sign of c
+        int32_t                 exp;            // unbiased exponent of c
+        std::vector<Digit>      digits;         // non-zero CSD digits of the mantissa
+    };
+    ConstMultiplier make_const_multiplier( FLT c ) const;                // for to_t( c )
+    ConstMultiplier make_const_multiplier_t( const T& c ) const;         // for encoded c
+
     //-----------------------------------------------------
     // Construction
     //-----------------------------------------------------
@@ -201,6 +293,7 @@ public:
     T    fma( const T& x, const T& y, const T& addend ) const;          // x*y + addend
     T    mul( const T& x, const T& y ) const;                           // x*y 
     T    mulc( const T& x, const T& c ) const;                          // x*c where c is known to be a constant
+    T    mulc( const T& x, const ConstMultiplier& c ) const;            // x*c using a ConstMultiplier from make_const_multiplier()
     T    sqr( const T& x ) const;                                       // x*x
     T    fda( const T& y, const T& x, const T& addend ) const;          // y/x + addend
     T    div( const T& y, const T& x ) const;                           // y/x
@@ -225,17 +318,19 @@ public:
 
     // elementary functions
     T    sqrt( const T& x ) const;                                      // hypoth( x+1, x-1 ) / 2
-    T    rsqrt( const T& x ) const;                                     // 1.0 / sqrt( x )
+    T    rsqrt( const T& x ) const;                                     // 1.0 / sqrt( x )          (seed table + Newton or Goldschmidt)
     T    rsqrt_orig( const T& x ) const;                                // x^(-1/2) = exp(log(x)/-2)
-    T    cbrt( const T& x ) const;                                      // x^(1/3)  = exp(log(x)/3)
-    T    rcbrt( const T& x ) const;                                     // x^(-1/3) = exp(log(x)/-3)
+    T    cbrt( const T& x ) const;                                      // x^(1/3)  = a*rcbrt(a)^2  (exponent split by 3 + Newton)
+    T    cbrt_orig( const T& x ) const;                                 // x^(1/3)  = exp(log(x)/3)
+    T    rcbrt( const T& x ) const;                                     // x^(-1/3)                 (exponent split by 3 + Newton)
+    T    rcbrt_orig( const T& x ) const;                                // x^(-1/3) = exp(log(x)/-3)
 
     T    exp( const T& x ) const;                                       // e^x
     T    expm1( const T& x ) const;                                     // e^x - 1
     T    expc( const FLT& b, const T& x ) const;                        // b^x  = exp(x * log(b))  b=const     (2)
     T    exp2( const T& x ) const;                                      // 2^x
     T    exp10( const T& x ) const;                                     // 10^x
-    T    pow( const T& b, const T& x ) const;                           // b^x  = exp(x * log(b))              (3)
+    T    pow( const T& b, const T& x ) const;                           // b^x  = exp(x * log(b)), or by squaring for integer x  (3)
     T    log( const T& x ) const;                                       // 2*atanh2(x-1, x+1)    
     T    log( const T& x, const T& b ) const;                           // log(x)/log(b)                (3)
     T    log1p( const T& x ) const;                                     // 2*atanh2(x, x+2) = log(x+1)
@@ -251,6 +346,8 @@ public:
     T    cospi( const T& x, const T * r=nullptr ) const;                // r*cos(x*PI)                (defualt r is 1
     void sincos( const T& x, T& si, T& co, const T * r=nullptr ) const; // si=r*sin(x), co=r*cos(x)   (default r is 1)
     void sinpicospi( const T& x, T& si, T& co, const T * r=nullptr ) const;// si=r*sin(x*PI), co=r*cos(x*PI) (default r is 1)
+    void sincos_batch( const T * x, T * si, T * co, size_t cnt, const T * r=nullptr ) const;     // sincos() on x[0..cnt-1]     (r[] is optional)
+    void sinpicospi_batch( const T * x, T * si, T * co, size_t cnt, const T * r=nullptr ) const; // sinpicospi() on x[0..cnt-1] (r[] is optional)
     T    tan( const T& x ) const;                                       // sin(x) / cos(x)              (2)
     T    tanpi( const T& x ) const;                                     // sin(x*PI) / cos(x*PI)        (2)
     T    asin( const T& x ) const;                                      // atan2(x, sqrt(1 - x^2))      (2)
@@ -288,6 +385,7 @@ public:
     // 1-(1-x)^2        = x * (2-x)
     //
     // pow(b,x)         = exp(log(b) * x)
+    //                  = b * b * ... * b                       x = integer, by repeated squaring; rcp() of that if x < 0
     // exp2(x)          = 2^x = exp(log(2) * x) 
     // exp(x)           = exp2(log2(e) * x)
     // exp2(i+f)        = exp2(i) * exp2(f)                     i = integer part, f = fractional remainder
@@ -443,6 +541,10 @@ public:
 
     //-----------------------------------------------------
     // The basic CORDIC functions that all the above math functions ultimately use.
+    //
+    // If CORE is not void, these call CORE's *_unrolled() versions directly (no virtual
+    // dispatch) whenever the modes are at their defaults, which is checked only when a
+    // mode changes.  The constructor always uses the loops here.
     //-----------------------------------------------------
 
     // circular rotation mode results after step n:
@@ -462,6 +564,22 @@ public:
     //
     void circular_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
 
+    // batch version of circular_rotation() for cnt independent (x0,y0,z0) triples.
+    // Results are bit-identical to circular_rotation(), but each micro-rotation
+    // is branch-free and applied across a block of lanes so that it vectorizes.
+    // The output arrays may alias the input arrays.
+    //
+    void circular_rotation_batch( const T * x0, const T * y0, const T * z0, T * x, T * y, T * z, size_t cnt ) const;
+
+    // circular_rotation() split in two:
+    // circular_rotation_dirs() runs only the z datapath and returns the direction of each step
+    // (bit i set means z >= 0 at step i).  circular_rotation_xy() then runs only the x/y datapath,
+    // so one z0 can be applied to many (x0,y0) pairs.  Results are bit-identical to the 
+    // classic radix-2 circular_rotation() regardless of the Modes above.
+    //
+    uint64_t circular_rotation_dirs( const T& z0 ) const;
+    void     circular_rotation_xy( const T& x0, const T& y0, uint64_t dirs, T& x, T& y ) const;
+
     // circular vectoring mode results after step n:
     //      x = gain*sqrt(x0^2 + y0^2)                  gain=1.64676...
     //      y = 0
@@ -496,7 +614,9 @@ public:
     //      -2 <= y <= 2
     //      0  <= z <= 0
     //
-    void hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    // atanh_tbl replaces the atanh(2^-i) table, see base_scaled_ok(); nullptr means the usual table.
+    //
+    void hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, const T * atanh_tbl=nullptr ) const;
 
     // hyperbolic vectoring mode results after step n:
     //      x = gain*sqrt(x0^2 - y0^2)                  gain=0.828159...
@@ -514,7 +634,9 @@ public:
     //      0     <= y <= 0
     //      -PI/2 <= z <= PI/2  (if z0 == 0)
     //
-    void hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    // atanh_tbl is as for hyperbolic_rotation().
+    //
+    void hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, const T * atanh_tbl=nullptr ) const;
     void hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const;  // if z not needed
 
     // linear rotation mode results after step n:
@@ -562,17 +684,19 @@ public:
     T    fma_fda( bool is_fma, const T& x, const T& y, const T& addend, bool is_final ) const;
     T    mul( const T& x, const T& y, bool is_final ) const;                 
     T    mulc( const T& x, const T& c, bool is_final ) const;
+    T    mulc( const T& x, const ConstMultiplier& c, bool is_final ) const;
     T    sqr( const T& x, bool is_final ) const;
     T    div( const T& y, const T& x, bool is_final ) const;                  
     T    sqrt( const T& x, bool is_final ) const;                              
     T    exp( const T& x, bool is_final, FLT b=M_E ) const;                              
-    T    log( const T& x, bool is_final ) const;                             
+    T    log( const T& x, bool is_final, FLT b=M_E ) const;                  // log_b(x)
     T    log1p( const T& x, bool is_final ) const;                          
     T    hypot( const T& x, const T& y, bool is_final ) const;          
     T    hypoth( const T& x, const T& y, bool is_final ) const;          
     T    atan2(  const T& y, const T& x, bool is_final, bool x_is_one, T * r ) const; 
-    T    atanh2( const T& y, const T& x, bool is_final, bool x_is_one ) const; 
+    T    atanh2( const T& y, const T& x, bool is_final, bool x_is_one, const T * atanh_tbl=nullptr ) const;  // atanh_tbl: see base_scaled_ok()
     void sincos( bool times_pi, const T& x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * r ) const;
+    void sincos_batch( bool times_pi, const T * x, T * si, T * co, size_t cnt, const T * r ) const;
     void sinhcosh( const T& x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * r ) const;
 
     //-----------------------------------------------------
@@ -607,14 +731,36 @@ public:
     EXP_CLASS classify( const T& x ) const;                                              // returns exp class only
     void deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& sign, bool allow_debug=true ) const;  // x will end up as fixed-point for _is_float=true
     void reconstruct( T& x, EXP_CLASS  x_exp_class, int32_t  x_exp, bool  sign ) const;  // x will end up as float value for _is_float=true
+    int32_t msb( const T& x ) const;                                                     // index of most-significant 1 bit of x > 0
+    T    rshift_sticky( const T& x, uint32_t s ) const;                                  // x >= 0 shifted right by s, ORing lost bits into the lsb
+    T    to_int( const T& x ) const;                                                     // integral encoded x to a plain integer using shifts (low bits only if huge)
 
     void reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const; 
     void reduce_mul_div_args( bool is_fma, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const; 
     void reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const;
-    void reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign ) const;
-    void reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend ) const;
+    void reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign, bool scaled=false ) const;  // scaled: x=f, not log(2)*f
+    void reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend, FLT b=M_E ) const;                   // addend=exp*log_b(2)
     void reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const;
-    void reduce_sincos_arg( bool times_pi, T& a, uint32_t& quadrant, EXP_CLASS& exp_class, bool& sign, bool& did_minus_pi_div_4 ) const;
+    void reduce_sincos_arg( bool times_pi, T& a, uint32_t& quadrant, EXP_CLASS& exp_class, bool& sign ) const;
+    bool reduce_sincos_arg_payne_hanek( T& a, uint32_t& quadrant ) const;  // a >= 0; returns false if a is beyond the 2/PI bits we have
+    bool reduce_sincos_arg_fxd( bool times_pi, const T& m, int32_t e, T& a, uint32_t& quadrant ) const;  // a = m*2^(e-frac_guard_w) >= 0, m from deconstruct();
+                                                                                                        // integer-only, false if e or the format is too wide
+    T    reconstruct_round( const T& v, int32_t exp, bool sign, bool is_final ) const;  // reconstruct() of fixed-point v >= 0 as NORMAL (or ZERO), 
+                                                                                        // then rfrac() if is_final
+    bool rfrac_up( const T& guard, bool sign, int rmode ) const;                        // true if rfrac() adds one frac lsb to the magnitude 
+                                                                                        // when it clears nonzero guard bits
+
+    // finishes sincos() after reduce_sincos_arg() and, for NORMAL x, circular_rotation() into co/si;
+    // r_exp/r_sign are for an r folded into x0 by fold_r(), and r (if not null) is instead applied using mul()
+    void sincos_fixup( const T& x_orig, T x, EXP_CLASS x_exp_class, bool x_sign, uint32_t quadrant,
+                       T& si, T& co, bool is_final, bool need_si, bool need_co, int32_t r_exp, bool r_sign, const T * r ) const;
+
+    // x0 = mantissa(r)/2 * one_over_gain; returns false if r is zero, infinite or NaN, which the caller must handle with mul()
+    bool fold_r( const T * r, const T& one_over_gain, T& x0, int32_t& r_exp, bool& r_sign ) const;
+
+    // z = x in fixed-point; returns false unless hyperbolic_neg_iter is on, x is floating-point NORMAL or SUBNORMAL, 
+    // and -neg_max <= x <= the extended hyperbolic rotation range
+    bool hyperbolic_neg_arg( const T& x, const T& neg_max, T& z ) const;
 
     //-----------------------------------------------------
     // Logging Support
@@ -756,6 +902,61 @@ public:
 
     static constexpr uint32_t OP_cnt = uint32_t(OP::dram_wr) + 1;
 
+    //-----------------------------------------------------
+    // Per-Function Iteration Counts
+    //
+    // By default every core routine does n iterations (from the constructor).
+    // n_for_set() gives an OP its own count, which then applies to all core routines 
+    // called under the outermost call of that OP on the same thread.  Configure these
+    // right after construction, like the Modes above.
+    //
+    // n_for_calibrate() walks n_for(op) down from n and keeps the smallest count whose
+    // error over the given samples stays within max_err, measured in units of the last 
+    // place of max(|f(x)|, 1).  ys[] supplies the second operand for mul, div, pow, atan2 and hypot.
+    //-----------------------------------------------------
+    void     n_for_set( OP op, uint32_t n );    // (n+1)/2 .. n, where n is from the constructor (the default)
+    uint32_t n_for( OP op ) const;              // current count for op
+    uint32_t n_for_calibrate( OP op, FLT max_err, const FLT * xs, size_t cnt, const FLT * ys=nullptr );  // returns the new n_for(op)
+
+    //-----------------------------------------------------
+    // Full-Table Lookup
+    //
+    // For formats of at most 16 bits (1+int_exp_w+frac_w), lookup_tables_build() runs each 
+    // chosen unary function on every finite input encoding with abs_min <= |x| <= abs_max and 
+    // keeps the results.  The CORDIC path must accept every input in that range.  Later calls whose
+    // input is in the range and has clear guard bits are then one load, bit-exact with what the 
+    // CORDIC path returned at build time; other inputs go the usual way.  Changing a mode, n_for(), 
+    // or the rounding mode afterward makes the tables stale, and they are skipped until rebuilt or reloaded.
+    //
+    // The build is split across thread_cnt std::threads (0 means std::thread::hardware_concurrency()).
+    // Logging is suspended on the building threads.
+    //-----------------------------------------------------
+    static bool lookup_supported( OP op );      // rcp, sqrt, rsqrt, cbrt, rcbrt, exp*, log*, trig, hyperbolic and their inverses
+    void lookup_tables_build( const std::vector<OP>& ops, FLT abs_min=FLT(0), FLT abs_max=std::numeric_limits<FLT>::infinity(), 
+                              uint32_t thread_cnt=0 );
+    void lookup_tables_clear( void );
+    bool lookup_table_has( OP op ) const;       // true if op has a table
+    bool lookup_tables_save( std::string file_name ) const;  // false if the file cannot be written
+    bool lookup_tables_load( std::string file_name );        // false if the file cannot be read or was saved from a different format
+
+    //-----------------------------------------------------
+    // Memo Cache
+    //
+    // memo_cache_set( entry_cnt ) gives each thread that uses this Cordic its own direct-mapped
+    // cache of entry_cnt results per OP, keyed by the encoded operands.  Outermost calls to 
+    // the table-supported functions above and to mul, div, pow, atan2 and hypot check it before 
+    // computing.  A thread takes this Cordic's lock only the first time it touches its cache; after that
+    // threads share only the hit/miss counters.  Changing a mode, n_for() or the rounding mode invalidates 
+    // all caches.  The caches belong to the Cordic and are freed when it is destroyed.
+    //
+    // entry_cnt must be a power of 2; 0 (the default) turns caching off.
+    // The logger sees each lookup through Logger::memo_lookup().
+    //-----------------------------------------------------
+    void     memo_cache_set( uint32_t entry_cnt );
+    uint32_t memo_cache( void ) const;          // current entry_cnt
+    uint64_t memo_cache_hit_cnt( void ) const;  // over all threads since memo_cache_set()
+    uint64_t memo_cache_miss_cnt( void ) const;
+
 
 
 
@@ -788,6 +989,9 @@ public:
 //-----------------------------------------------------
 //-----------------------------------------------------
 
+protected:
+    static T cneg( const T& v, const T& m );                             // m=0: v, m=-1: -v   (no branch)
+
 private:
     bool                        _is_float;
     uint32_t                    _int_w;
@@ -802,8 +1006,10 @@ private:
     int32_t                     _exp_unbiased_min;
     int32_t                     _exp_unbiased_max;
     uint32_t                    _w;
+    uint32_t                    _t_w;                                    // usable bits in T: all of a built-in integer, else _w
     uint32_t                    _n;
     int                         _rounding_mode;
+    uint32_t                    _radix;
 
     T                           _quiet_NaN_fxd;
     T                           _maxint;
@@ -834,14 +1040,38 @@ private:
     T                           _tau;
     T                           _pi_div_2;
     T                           _pi_div_4;
+    T                           _pi_div_4_fxd;
+    int32_t                     _payne_hanek_exp_min;                    // reduce_sincos_arg() uses Payne-Hanek for exponents >= this
     T                           _one_div_pi;
     T                           _two_div_pi;
     T                           _four_div_pi;
     T                           _e;
     T                           _log2;                                   
     T                           _log10;                                 
-
-    T *                         _circular_atan_fxd;                      // circular atan values
+    T                           _log2_of_e;                              // log2(b) for the common expc() bases
+    T                           _log2_of_2;
+    T                           _log2_of_10;
+    const std::map<T, ConstMultiplier> * _const_multipliers;             // CSD recodings of the constants below by value (shared)
+    const ConstMultiplier *     _third_cm;                               // ... and the ones mulc() call sites use directly
+    const ConstMultiplier *     _neg_third_cm;
+    const ConstMultiplier *     _pi_cm;
+    const ConstMultiplier *     _one_div_pi_cm;
+    const ConstMultiplier *     _log2_cm;
+    const ConstMultiplier *     _log2_of_e_cm;
+    const ConstMultiplier *     _log2_of_2_cm;
+    const ConstMultiplier *     _log2_of_10_cm;
+    const ConstMultiplier *     _180_cm;
+    const ConstMultiplier *     _one_div_180_cm;
+    const ConstMultiplier *     _circular_vectoring_one_over_gain_cm;
+    const ConstMultiplier *     _hyperbolic_vectoring_one_over_gain_cm;
+    int32_t                     _exp_times_log2_min;                     // first exponent in _exp_times_log2[]
+    const T *                   _exp_times_log2;                         // exp*log(2) for every exponent reduce_log_arg() can see (shared)
+    const T *                   _exp_times_log2_b2;                      // exp*log_b(2) for b=2 and b=10, indexed like _exp_times_log2[] (shared)
+    const T *                   _exp_times_log2_b10;
+    const T *                   _base2_atanh_fxd;                        // atanh(2^-i)/log(2), see base_scaled_ok() (shared)
+    const T *                   _base10_atanh_fxd;                       // atanh(2^-i)/log(10) (shared)
+
+    const T *                   _circular_atan_fxd;                      // circular atan values (shared)
     T                           _circular_rotation_gain_fxd;             // circular rotation gain
     T                           _circular_rotation_one_over_gain_fxd;    // circular rotation 1/gain
     T                           _circular_rotation_one_over_gain;        // circular rotation 1/gain
@@ -850,7 +1080,7 @@ private:
     T                           _circular_vectoring_one_over_gain;       // circular vectoring 1/gain
     T                           _circular_angle_max_fxd;                 // circular vectoring |z0| max value
 
-    T *                         _hyperbolic_atanh_fxd;                   // hyperbolic atanh values
+    const T *                   _hyperbolic_atanh_fxd;                   // hyperbolic atanh values (shared)
     T                           _hyperbolic_rotation_gain_fxd;           // hyperbolic rotation gain
     T                           _hyperbolic_rotation_one_over_gain_fxd;  // hyperbolic rotation 1/gain
     T                           _hyperbolic_rotation_one_over_gain;      // hyperbolic rotation 1/gain
@@ -859,29 +1089,247 @@ private:
     T                           _hyperbolic_vectoring_one_over_gain;     // hyperbolic vectoring 1/gain
     T                           _hyperbolic_angle_max_fxd;               // hyperbolic vectoring |z0| max value
 
+    uint32_t                    _radix4_m;                               // radix-4 iterations are j=0..m (hyperbolic: j=1..m)
+    T *                         _circular_radix4_scale_fxd;              // radix-4 [2*j+d-1] = 1/sqrt(1 + (d*4^-j)^2)
+    T *                         _hyperbolic_radix4_scale_fxd;            // radix-4 [2*j+d-1] = 1/sqrt(1 - (d*4^-j)^2)
+    T                           _hyperbolic_radix4_angle_max_fxd;        // radix-4 hyperbolic |z0| max value (else uses radix-2)
+
+    struct LutEntry
+    {
+        T                       c;                                       // cos(a)/gain_s  or cosh(a)/gain_s
+        T                       s;                                       // sin(a)/gain_s  or sinh(a)/gain_s
+        T                       a;                                       // bucket center angle
+    };
+
+    uint32_t                    _lut_prefix_w;                           // k
+    LutEntry *                  _circular_lut;                           // 2^k entries covering z0 in [-1, 1)
+    uint32_t                    _circular_lut_start_i;                   // first iteration done after lookup
+    LutEntry *                  _hyperbolic_lut;                         // 2^k entries covering z0 in [-2, 2)
+    uint32_t                    _hyperbolic_lut_start_i;                 // first iteration done after lookup
+
+    uint32_t lut_prefix( bool is_circular, const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;  // returns next iteration
+
+    uint32_t                    _hyperbolic_neg_iter_cnt;                // k
+    T *                         _hyperbolic_neg_atanh_fxd;               // atanh(1-2^(i-2)) for i = 1-k .. 0
+    T                           _hyperbolic_neg_one_over_gain_fxd;       // 1/gain of those k iterations
+    T                           _hyperbolic_neg_angle_max_fxd;           // extended hyperbolic rotation |z0| max value
+    T                           _hyperbolic_neg_exp_min_fxd;             // most negative exp() arg that still skips reduction
+
+    bool                        _small_angle_skip;                       // see small_angle_skip_set()
+    T *                         _circular_skip_gain_fxd;                 // [s] = gain of iterations 0 .. s-1
+    T *                         _hyperbolic_skip_gain_fxd;               // [s] = gain of iterations 1 .. s-1, including repeats
+
+    bool                        _early_exit;                             // see early_exit_set()
+    T *                         _circular_tail_gain_fxd;                 // [i] = gain of iterations i .. n
+    T *                         _hyperbolic_tail_gain_fxd;               // [i] = gain of iterations i .. n, including repeats
+
+    static constexpr uint32_t SMALL_ANGLE_SKIP_MIN = 4;                  // fewer skipped iterations don't pay for the gain multiplies
+    uint32_t small_angle_start( T a, const T& b, uint32_t n ) const;     // s such that |a/b| < 2^-s, capped at n; 0 if below SMALL_ANGLE_SKIP_MIN
+
+    uint32_t                    _circular_dirs_recode_i;                 // atan(2^-i) == 2^-i for all i >= this
+    bool                        _linear_finish;                          // see linear_finish_set()
+    uint32_t                    _n_for[OP_cnt];                          // see n_for_set()
+    bool                        _n_for_is_default;                       // true if all _n_for[] == _n
+    bool                        _unrolled;                               // CORE's *_unrolled() core routines are in use
+    void unrolled_update( void );                                        // recompute _unrolled after a mode change
+
+    struct NForScope                                                     // the outermost OP call on a thread picks the iteration count
+    {
+        NForScope( const Cordic * cordic, OP op );
+        ~NForScope();
+        bool is_outermost;
+    };
+    static thread_local const Cordic * n_for_owner;                      // Cordic of the outermost OP call on this thread
+    static thread_local uint32_t       n_for_n;                          // its n_for()
+
+    uint32_t iter_n( bool is_linear ) const;                             // last iteration for core routines under the current OP
+
+    // log2/log10/logc(x,2|10) and exp2/exp10/expc run their hyperbolic pass with the atanh table 
+    // scaled by 1/log(b), so z comes out in (or goes in as) base-b units without a multiply.
+    // The tables go to hyperbolic_rotation()/hyperbolic_vectoring() as atanh_tbl.  Only the plain radix-2 
+    // loops use atanh_tbl, so other modes that change the hyperbolic loops turn them off.
+    bool     base_scaled_ok( FLT b ) const;                              // b is 2 or 10 and modes allow the scaled loops
+    const T * base_scaled_atanh( FLT b ) const;                          // scaled atanh table for b
+
+    // pow(b,x) with finite b and integral x, |x| <= POW_INT_MAX, squares and multiplies with mul() 
+    // instead of going through exp(x*log(b)).  This also gives the right sign for negative b.
+    static constexpr uint32_t POW_INT_MAX = 64;
+    bool     pow_int_exp( const T& b, const T& x, int32_t& k ) const;   // true if the above holds, k = x
+
+    T *                         _lookup_tbl[OP_cnt];                     // see lookup_tables_build()
+    T                           _lookup_mag_min[OP_cnt];                 // tabled index magnitudes (sign bit dropped)
+    T                           _lookup_mag_max[OP_cnt];
+    int                         _lookup_rounding_mode;                   // rounding mode the tables were built with
+    uint64_t                    _lookup_epoch[OP_cnt];                   // _memo_epoch when each table was built or loaded
+    uint32_t lookup_w( void ) const;                                     // 1+int_exp_w+frac_w
+    T        lookup_mag( const T& i ) const;                             // magnitude of index i
+    bool     lookup( OP op, const T& x, T& r ) const;                    // r = table entry for x; false if no table or x has guard bits
+    T        unary_eval( OP op, const T& x ) const;                      // op(x) for lookup_supported() ops
+
+    struct MemoEntry
+    {
+        T       x;
+        T       y;
+        T       r;
+        bool    valid;
+    };
+    struct MemoCache                                                     // one per Cordic per thread
+    {
+        uint64_t                epoch;
+        std::vector<MemoEntry>  entries;                                 // OP_cnt sets of _memo_entry_cnt
+    };
+    uint32_t                    _memo_entry_cnt;                         // see memo_cache_set()
+    uint64_t                    _memo_id;                                // keys this Cordic's thread caches
+    uint64_t                    _memo_epoch;                             // bumped when cached results go stale
+    mutable std::atomic<uint64_t> _memo_hit_cnt;
+    mutable std::atomic<uint64_t> _memo_miss_cnt;
+    mutable std::mutex          _memo_mutex;                             // guards _memo_caches
+    mutable std::unordered_map<std::thread::id, std::unique_ptr<MemoCache>> _memo_caches;  // this Cordic's cache for each thread
+    static std::atomic<uint64_t>  memo_id_next;                          // starts at 1 so that 0 marks an empty MemoSlot
+    struct MemoSlot                                                      // a thread's recently used caches, found without the lock
+    {
+        uint64_t                id;                                      // _memo_id of the owning Cordic; ids are never reused
+        MemoCache *             cache;
+    };
+    static constexpr uint32_t   MEMO_SLOT_CNT = 8;
+    static thread_local MemoSlot memo_slots[MEMO_SLOT_CNT];             // searched by id; refilled round-robin
+    static thread_local uint32_t memo_slot_next;                         // next memo_slots[] entry to refill
+    MemoCache& memo_cache_get( void ) const;                             // this thread's cache, created on first use
+    template< typename F > T memo( OP op, const T& x, const T& y, F compute ) const;  // cached compute() for outermost calls
+    bool     n_for_eval( OP op, FLT x, FLT y, FLT& got, FLT& ref ) const; // for n_for_calibrate(); false if op has no reference
+    bool                        _native_muldiv;                          // see native_muldiv_set()
+    DIV_ENGINE                  _div_engine;                             // see div_engine_set()
+    const T *                   _rcp_seed_fxd;                           // 1/x       for x in [1,2), indexed by the top 8 fraction bits (shared)
+    const T *                   _rsqrt_seed_fxd;                         // 1/sqrt(a) for a in [1,4), indexed by a*64 (first 64 unused) (shared)
+    const T *                   _rcbrt_seed_fxd;                         // 1/cbrt(a) for a in [1,8), indexed by a*32 (first 32 unused) (shared)
+    uint32_t                    _rcp_iter_cnt;                           // iterations after the seed lookup for each
+    uint32_t                    _rsqrt_iter_cnt;
+    uint32_t                    _rcbrt_iter_cnt;
+    T                           _third_fxd;                              // 1/3 as fixed-point
+
+    T    mul_fxd( const T& x, const T& y ) const;                        // fixed-point x*y using a wide intermediate
+    T    div_fxd( const T& x, const T& y ) const;                        // fixed-point x/y using a wide intermediate
+    T    mul_fxd_sticky( const T& x, const T& y ) const;                 // mul_fxd() with the dropped bits ORed into the lsb
+    T    div_fxd_sticky( const T& x, const T& y ) const;                 // div_fxd() with a non-zero remainder ORed into the lsb
+
+    __extension__ typedef typename std::conditional< sizeof( T ) <= sizeof( int64_t ), __int128, T >::type T2;    // wide intermediate
+
+    T    div_engine_div( const T& y, const T& x ) const;                 // y/x for mantissas in [1,2) using _div_engine, sticky lsb
+    T    div_engine_sqrt( const T& a ) const;                            // sqrt(a) for a in [1,4) using _div_engine, sticky lsb
+    static int32_t srt4_digit( const int8_t * m, int32_t est );          // SRT4 digit for a 1/16-truncated estimate given 4 thresholds
+    static void    srt4_append( T& q, T& qm, int32_t s );                // SRT4 on-the-fly conversion of digit s into q and qm = q-1
+    T    rsqrt_kernel( const T& a ) const;                               // 1/sqrt(a) for a in [1,4), Goldschmidt if that is the div_engine else Newton
+    T    rcbrt_kernel( const T& a ) const;                               // 1/cbrt(a) for a in [1,8), Newton
+    T    cbrt_rcbrt( const T& x, bool is_rcbrt ) const;                  // shared by cbrt() and rcbrt()
+    void normalize( T& m, int32_t& e ) const;                            // shift a SUBNORMAL mantissa up into [1,2), adjusting e
+    T    div_fix_up( const T& y, const T& x, T q ) const;                // nudge q until 0 <= y-q*x < x, then sticky lsb
+    T    sqrt_fix_up( const T& a, T q ) const;                           // nudge q until 0 <= a-q*q <= 2q, then sticky lsb
+    T    seed( const T * seeds, const T& x, uint32_t int_w ) const;      // seeds[] entry for the 8 bits of x just below 2^int_w
+    T    circular_radix4_atan( uint32_t i ) const;                       // atan(2^-i)  even for i > n
+    T    hyperbolic_radix4_atanh( uint32_t i ) const;                    // atanh(2^-i) even for i > n
+    uint32_t radix4_rotation_digit( const T& az, const T& a1, const T& a2, bool allow_2 ) const;
+    uint32_t radix4_vectoring_digit( const T& ay, const T& ax, uint32_t j, bool allow_2 ) const;
+    bool hyperbolic_radix4_vectoring_ok( const T& x0, const T& y0 ) const;
+    void circular_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void circular_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, bool need_z ) const;
+    void hyperbolic_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void hyperbolic_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, bool need_z ) const;
+    void linear_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void linear_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+
+    //-----------------------------------------------------
+    // The atan/atanh tables, gains, angle maxima, and other tables that depend only on 
+    // the number format and n are built once per (is_float, int_exp_w, frac_w, guard_w, n) 
+    // by the first Cordic that needs them and then shared read-only by all Cordics.  
+    // They are never freed.
+    //-----------------------------------------------------
+    struct SharedTables
+    {
+        T *                     circular_atan_fxd;
+        T                       circular_rotation_gain_fxd;
+        T                       circular_vectoring_gain_fxd;
+        T                       circular_angle_max_fxd;
+        T *                     hyperbolic_atanh_fxd;
+        T                       hyperbolic_rotation_gain_fxd;
+        T                       hyperbolic_vectoring_gain_fxd;
+        T                       hyperbolic_angle_max_fxd;
+        const T *               exp_times_log2;                          // see _exp_times_log2
+        const T *               exp_times_log2_b2;
+        const T *               exp_times_log2_b10;
+        const T *               base2_atanh_fxd;                         // see _base2_atanh_fxd
+        const T *               base10_atanh_fxd;
+        std::map<T, ConstMultiplier> const_multipliers;                  // see _const_multipliers
+        const T *               rcp_seed_fxd;                            // see _rcp_seed_fxd
+        const T *               rsqrt_seed_fxd;
+        const T *               rcbrt_seed_fxd;
+    };
+
+    using SharedTablesKey = std::tuple<bool, uint32_t, uint32_t, uint32_t, uint32_t>;  // is_float, int_exp_w, frac_w, guard_w, n
+
+    static std::map<SharedTablesKey, const SharedTables *> shared_tables;
+    static std::mutex                                      shared_tables_mutex;
+
     static Logger<T,FLT> * logger;
+    static thread_local bool logger_suppressed;                          // true on threads that must not log, see lookup_tables_build()
+    static bool logger_on( void );                                       // logger is set and not suppressed on this thread
 };
 
 //-----------------------------------------------------
 // Logging
 //-----------------------------------------------------
-template< typename T, typename FLT >
-Logger<T,FLT> * Cordic<T,FLT>::logger = nullptr;
+template< typename T, typename FLT, typename CORE >
+Logger<T,FLT> * Cordic<T,FLT,CORE>::logger = nullptr;
+
+template< typename T, typename FLT, typename CORE >
+thread_local bool Cordic<T,FLT,CORE>::logger_suppressed = false;
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::logger_on( void )
+{
+    return logger != nullptr && !logger_suppressed;
+}
+
+//-----------------------------------------------------
+// Per-Function Iteration Counts
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+thread_local const Cordic<T,FLT,CORE> * Cordic<T,FLT,CORE>::n_for_owner = nullptr;
+
+template< typename T, typename FLT, typename CORE >
+thread_local uint32_t Cordic<T,FLT,CORE>::n_for_n = 0;
+
+template< typename T, typename FLT, typename CORE >
+std::atomic<uint64_t> Cordic<T,FLT,CORE>::memo_id_next( 1 );
+
+template< typename T, typename FLT, typename CORE >
+thread_local typename Cordic<T,FLT,CORE>::MemoSlot Cordic<T,FLT,CORE>::memo_slots[Cordic<T,FLT,CORE>::MEMO_SLOT_CNT];
+
+template< typename T, typename FLT, typename CORE >
+thread_local uint32_t Cordic<T,FLT,CORE>::memo_slot_next = 0;
+
+//-----------------------------------------------------
+// Shared Tables
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+std::map<typename Cordic<T,FLT,CORE>::SharedTablesKey, const typename Cordic<T,FLT,CORE>::SharedTables *> Cordic<T,FLT,CORE>::shared_tables;
+
+template< typename T, typename FLT, typename CORE >
+std::mutex Cordic<T,FLT,CORE>::shared_tables_mutex;
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::logger_set( Logger<T,FLT> * _logger )
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::logger_set( Logger<T,FLT> * _logger )
 {
     logger = _logger;
 }    
 
-template< typename T, typename FLT >
-Logger<T,FLT> * Cordic<T,FLT>::logger_get( void )
+template< typename T, typename FLT, typename CORE >
+Logger<T,FLT> * Cordic<T,FLT,CORE>::logger_get( void )
 {
     return logger;
 }    
 
-template< typename T, typename FLT >
-std::string Cordic<T,FLT>::op_to_str( uint16_t op )
+template< typename T, typename FLT, typename CORE >
+std::string Cordic<T,FLT,CORE>::op_to_str( uint16_t op )
 {
     #define _ocase( op ) case OP::op: return #op;
     
@@ -998,24 +1446,39 @@ std::string Cordic<T,FLT>::op_to_str( uint16_t op )
     }
 }
 
+#define _n_for_scope( op ) \
+            const NForScope _n_for_scope_( this, Cordic<T,FLT,CORE>::OP::op )
+
+#define _lookup_1( op, opnd1 ) \
+            T _lookup_r_; if ( lookup( Cordic<T,FLT,CORE>::OP::op, opnd1, _lookup_r_ ) ) return _lookup_r_
+#define _lookup_1r( op, opnd1 ) \
+            T _lookup_r_; if ( r == nullptr && lookup( Cordic<T,FLT,CORE>::OP::op, opnd1, _lookup_r_ ) ) return _lookup_r_
+
+#define _memo_1( op, opnd1, call ) \
+            if ( _memo_entry_cnt != 0 && _n_for_scope_.is_outermost ) return memo( Cordic<T,FLT,CORE>::OP::op, opnd1, _zero, [&]( void ) { return call; } )
+#define _memo_1r( op, opnd1, call ) \
+            if ( _memo_entry_cnt != 0 && _n_for_scope_.is_outermost && r == nullptr ) return memo( Cordic<T,FLT,CORE>::OP::op, opnd1, _zero, [&]( void ) { return call; } )
+#define _memo_2( op, opnd1, opnd2, call ) \
+            if ( _memo_entry_cnt != 0 && _n_for_scope_.is_outermost ) return memo( Cordic<T,FLT,CORE>::OP::op, opnd1, opnd2, [&]( void ) { return call; } )
+
 #define _log_1( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), &opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1 )
 #define _log_1i( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_1b( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_1f( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_2( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2 )
 #define _log_2i( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, opnd2 )
 #define _log_2f( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, opnd2 )
 #define _log_3( op, opnd1, opnd2, opnd3 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op3( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2, &opnd3 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op3( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2, &opnd3 )
 #define _log_4( op, opnd1, opnd2, opnd3, opnd4 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op4( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2, &opnd3, &opnd4 )
+            if ( Cordic<T,FLT,CORE>::logger_on() ) Cordic<T,FLT,CORE>::logger->op4( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2, &opnd3, &opnd4 )
 #define _logconst( c ) \
             constructed( c ); \
             _log_1f( push_constant, _to_flt(c) ); \
@@ -1024,12 +1487,12 @@ std::string Cordic<T,FLT>::op_to_str( uint16_t op )
 //-----------------------------------------------------
 // Constructor
 //-----------------------------------------------------
-template< typename T, typename FLT >
-Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint32_t guard_w, uint32_t n )
+template< typename T, typename FLT, typename CORE >
+Cordic<T,FLT,CORE>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint32_t guard_w, uint32_t n )
 {
     if ( n == uint32_t(-1) ) n = 1 + frac_w;
     if ( guard_w == uint32_t(-1) ) guard_w = std::ceil(std::log2(frac_w));
-    if ( logger != nullptr ) logger->cordic_constructed( this, int_exp_w, frac_w, is_float, guard_w, n );
+    if ( logger_on() ) logger->cordic_constructed( this, int_exp_w, frac_w, is_float, guard_w, n );
 
     cassert( (1+int_exp_w+frac_w+guard_w) <= (sizeof( T ) * 8), "1 + int_exp_w + frac_w + guard_w does not fit in T container" );
     cassert( int_exp_w != 0, "int_exp_w must be > 0" );
@@ -1048,8 +1511,44 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _exp_unbiased_min= is_float ? (0 - _exp_bias) : 0;
     _exp_unbiased_max= is_float ? ((1 << (int_exp_w-1))-1) : 0;
     _w               = 1 + int_exp_w + frac_w + guard_w;
+    _t_w             = std::is_integral<T>::value ? uint32_t(sizeof( T )*8) : _w;    // sizeof() of an mpint is not its int_w
     _n               = n;
     _rounding_mode   = FE_TONEAREST;
+    _radix           = 2;
+    _radix4_m        = 0;
+    _circular_radix4_scale_fxd   = nullptr;
+    _hyperbolic_radix4_scale_fxd = nullptr;
+    _hyperbolic_radix4_angle_max_fxd = 0;
+    _lut_prefix_w    = 0;
+    _circular_lut    = nullptr;
+    _hyperbolic_lut  = nullptr;
+    _circular_lut_start_i   = 0;
+    _hyperbolic_lut_start_i = 1;
+    _hyperbolic_neg_iter_cnt  = 0;
+    _hyperbolic_neg_atanh_fxd = nullptr;
+    _hyperbolic_neg_one_over_gain_fxd = 0;
+    _hyperbolic_neg_angle_max_fxd     = 0;
+    _hyperbolic_neg_exp_min_fxd       = 0;
+    _small_angle_skip         = false;
+    _circular_skip_gain_fxd   = nullptr;
+    _hyperbolic_skip_gain_fxd = nullptr;
+    _early_exit               = false;
+    _circular_tail_gain_fxd   = nullptr;
+    _hyperbolic_tail_gain_fxd = nullptr;
+    _linear_finish   = false;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) _n_for[i] = _n;
+    _n_for_is_default = true;
+    _unrolled        = false;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) _lookup_tbl[i] = nullptr;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) _lookup_epoch[i] = 0;
+    _lookup_rounding_mode = _rounding_mode;
+    _memo_entry_cnt  = 0;
+    _memo_id         = memo_id_next++;
+    _memo_epoch      = 0;
+    _memo_hit_cnt    = 0;
+    _memo_miss_cnt   = 0;
+    _native_muldiv   = false;
+    _div_engine      = DIV_ENGINE::CORDIC;
     _maxint          = is_float ? T(0) : ((T(1) << int_exp_w) - 1);
 
     // these must be done first because to_t() depends on some of them
@@ -1078,6 +1577,8 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _sqrt2_div_2     = to_t( std::sqrt( 2.0 ) / FLT(2.0) );
     _pi              = to_t( std::acos( FLT(-1.0) ) );
     _pi_fxd          = to_t( std::acos( FLT(-1.0) ), false, true );
+    _pi_div_4_fxd    = to_t( std::acos( FLT(-1.0) ) / FLT(4.0), false, true );
+    _payne_hanek_exp_min = _guard_w;                                    // the a*4/PI path loses about exp bits; the guard bits absorb that many
     _neg_pi          = to_t( -std::acos( FLT(-1.0) ) );
     _tau             = to_t( 2.0 * std::acos( FLT(-1.0) ) );
     _pi_div_2        = to_t( std::acos( FLT(-1.0) ) / FLT(2.0) );
@@ -1088,41 +1589,154 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _e               = to_t( std::exp( FLT(  1 ) ) );
     _log2            = to_t( std::log( FLT(  2 ) ) );
     _log10           = to_t( std::log( FLT( 10 ) ) );
+    _log2_of_e       = to_t( std::log2( FLT( M_E ) ), false );
+    _log2_of_2       = to_t( std::log2( FLT(  2 ) ), false );
+    _log2_of_10      = to_t( std::log2( FLT( 10 ) ), false );
+
+    _exp_times_log2_min = is_float ? (_exp_unbiased_min - 1) : -int32_t(_frac_guard_w + 1);
+    const int32_t exp_times_log2_max = is_float ? (_exp_unbiased_max + 2) : int32_t(_int_w + 2);  // reduce_log_arg() can reach unbiased max+2
+    //-----------------------------------------------------
+    // Iteration counts for the NEWTON and GOLDSCHMIDT div_engines and the rsqrt/rcbrt kernels.
+    // The seeds (in the shared tables) are good to 9, 8 and 7 bits.  Each iteration about doubles that
+    // (less a bit for rsqrt and rcbrt) until it covers the fraction and guard bits plus 2.
+    //-----------------------------------------------------
+    _rcp_iter_cnt   = 0;
+    _rsqrt_iter_cnt = 0;
+    _rcbrt_iter_cnt = 0;
+    for( uint32_t bits = 9; bits < (_frac_guard_w+2); bits = 2*bits )   _rcp_iter_cnt++;
+    for( uint32_t bits = 8; bits < (_frac_guard_w+2); bits = 2*bits-1 ) _rsqrt_iter_cnt++;
+    for( uint32_t bits = 7; bits < (_frac_guard_w+2); bits = 2*bits-2 ) _rcbrt_iter_cnt++;
+    _third_fxd = to_t( FLT(1) / FLT(3), false, true );
 
     _logconst( _zero );
     _logconst( _one  );
 
-    _circular_atan_fxd    = new T[n+1];
-    _hyperbolic_atanh_fxd = new T[n+1];
-
-    // compute atan/atanh table in high-resolution floating point
-    //
-    FLT pow2 = 1.0;
-    for( uint32_t i = 0; i <= n; i++ )
+    //-----------------------------------------------------
+    // Look up the shared tables for this format and n, building them if this is the first time.
+    //-----------------------------------------------------
     {
-        FLT a  = std::atan( pow2 );
-        FLT ah = std::atanh( pow2 );
-        _circular_atan_fxd[i] =    to_t( a, false, true );
-        _hyperbolic_atanh_fxd[i] = (i == 0) ? to_t( -1, false, true ) : to_t( ah, false, true );
+        std::lock_guard<std::mutex> lock( shared_tables_mutex );
+        const SharedTablesKey key( _is_float, int_exp_w, _frac_w, _guard_w, _n );
+        auto it = shared_tables.find( key );
+        if ( it == shared_tables.end() ) {
+            SharedTables * tables = new SharedTables;
+            T * exp_times_log2 = new T[exp_times_log2_max - _exp_times_log2_min + 1];
+            for( int32_t e = _exp_times_log2_min; e <= exp_times_log2_max; e++ )
+            {
+                exp_times_log2[e - _exp_times_log2_min] = to_t( FLT(e) * std::log(2) );
+            }
+            tables->exp_times_log2 = exp_times_log2;
 
-        if ( debug ) printf( "i=%2d a=%30.27g ah=%30.27g y=%30.27g\n", i, double(a), double(ah), double(pow2) );
-        pow2 /= 2.0;
-    }
+            // the same for log_b(2) with b=2 and b=10, and the atanh table scaled by 1/log(b) for those b
+            T * exp_times_log2_b2  = new T[exp_times_log2_max - _exp_times_log2_min + 1];
+            T * exp_times_log2_b10 = new T[exp_times_log2_max - _exp_times_log2_min + 1];
+            for( int32_t e = _exp_times_log2_min; e <= exp_times_log2_max; e++ )
+            {
+                const bool fits = is_float || FLT(std::abs(e)) <= FLT(_maxint);        // fixed-point never reaches the others
+                exp_times_log2_b2[e - _exp_times_log2_min]  = fits ? to_t( FLT(e) ) : _zero;
+                exp_times_log2_b10[e - _exp_times_log2_min] = to_t( FLT(e) * std::log10( FLT(2) ) );
+            }
+            T * base2_atanh  = new T[n+1];
+            T * base10_atanh = new T[n+1];
+            for( uint32_t i = 0; i <= n; i++ )
+            {
+                const FLT ah = (i == 0) ? FLT(-1) : std::atanh( std::ldexp( FLT(1), -int(i) ) );  // [0] is never used, as in _hyperbolic_atanh_fxd[]
+                base2_atanh[i]  = to_t( ah / std::log( FLT(2) ),  false, true );
+                base10_atanh[i] = to_t( ah / std::log( FLT(10) ), false, true );
+            }
+            tables->exp_times_log2_b2  = exp_times_log2_b2;
+            tables->exp_times_log2_b10 = exp_times_log2_b10;
+            tables->base2_atanh_fxd    = base2_atanh;
+            tables->base10_atanh_fxd   = base10_atanh;
+
+            // seeds for the NEWTON and GOLDSCHMIDT div_engines and the rsqrt/rcbrt kernels
+            T * rcp_seed   = new T[256];
+            T * rsqrt_seed = new T[256];
+            T * rcbrt_seed = new T[256];
+            for( uint32_t i = 0; i < 256; i++ )
+            {
+                const FLT m = FLT(i) + FLT(0.5);
+                rcp_seed[i]   = to_t( FLT(1) / (FLT(1) + m / FLT(256)), false, true );
+                rsqrt_seed[i] = (i < 64) ? _one_fxd : to_t( FLT(1) / std::sqrt( m / FLT(64) ), false, true );
+                rcbrt_seed[i] = (i < 32) ? _one_fxd : to_t( FLT(1) / std::cbrt( m / FLT(32) ), false, true );
+            }
+            tables->rcp_seed_fxd   = rcp_seed;
+            tables->rsqrt_seed_fxd = rsqrt_seed;
+            tables->rcbrt_seed_fxd = rcbrt_seed;
 
-    // calculate max |z0| angle allowed
-    T xx, yy, zz;
-    _circular_angle_max_fxd   = _one_fxd;   // to avoid triggering assert
-    _hyperbolic_angle_max_fxd = _zero_fxd;  // to disable assert
-    circular_vectoring(   _one_fxd,  _one_fxd, _zero_fxd, xx, yy, _circular_angle_max_fxd );
-    hyperbolic_vectoring( _half_fxd, _one_fxd, _zero_fxd, xx, yy, _hyperbolic_angle_max_fxd );
+            tables->circular_atan_fxd    = new T[n+1];
+            tables->hyperbolic_atanh_fxd = new T[n+1];
+
+            // compute atan/atanh table in high-resolution floating point
+            //
+            FLT pow2 = 1.0;
+            for( uint32_t i = 0; i <= n; i++ )
+            {
+                FLT a  = std::atan( pow2 );
+                FLT ah = std::atanh( pow2 );
+                tables->circular_atan_fxd[i] =    to_t( a, false, true );
+                tables->hyperbolic_atanh_fxd[i] = (i == 0) ? to_t( -1, false, true ) : to_t( ah, false, true );
+
+                if ( debug ) printf( "i=%2d a=%30.27g ah=%30.27g y=%30.27g\n", i, double(a), double(ah), double(pow2) );
+                pow2 /= 2.0;
+            }
+            _circular_atan_fxd    = tables->circular_atan_fxd;
+            _hyperbolic_atanh_fxd = tables->hyperbolic_atanh_fxd;
+
+            // calculate max |z0| angle allowed
+            T xx, yy, zz;
+            _circular_angle_max_fxd   = _one_fxd;   // to avoid triggering assert
+            _hyperbolic_angle_max_fxd = _zero_fxd;  // to disable assert
+            Cordic<T,FLT,CORE>::circular_vectoring(   _one_fxd,  _one_fxd, _zero_fxd, xx, yy, tables->circular_angle_max_fxd );
+            Cordic<T,FLT,CORE>::hyperbolic_vectoring( _half_fxd, _one_fxd, _zero_fxd, xx, yy, tables->hyperbolic_angle_max_fxd );
+            
+            // calculate gain by plugging in x=1,y=0,z=0 into CORDICs
+            Cordic<T,FLT,CORE>::circular_rotation(    _one_fxd, _zero_fxd, _zero_fxd, tables->circular_rotation_gain_fxd,    yy, zz );
+            Cordic<T,FLT,CORE>::circular_vectoring(   _one_fxd, _zero_fxd, _zero_fxd, tables->circular_vectoring_gain_fxd,   yy, zz );
+            Cordic<T,FLT,CORE>::hyperbolic_rotation(  _one_fxd, _zero_fxd, _zero_fxd, tables->hyperbolic_rotation_gain_fxd,  yy, zz );
+            Cordic<T,FLT,CORE>::hyperbolic_vectoring( _one_fxd, _zero_fxd, _zero_fxd, tables->hyperbolic_vectoring_gain_fxd, yy, zz );
+
+            // CSD recodings of the constants passed to mulc()
+            const T circular_vectoring_one_over_gain   = to_t( FLT(1) / _to_flt(tables->circular_vectoring_gain_fxd,   false, true ), false, false );
+            const T hyperbolic_vectoring_one_over_gain = to_t( FLT(1) / _to_flt(tables->hyperbolic_vectoring_gain_fxd, false, true ), false, false );
+            for( const T& c : { _third, _neg_third, _sqrt2_div_2, _pi, _pi_div_2, _pi_div_4, _one_div_pi, _two_div_pi, _four_div_pi, _log2, 
+                                _log2_of_e, _log2_of_2, _log2_of_10, to_t( FLT(180) ), to_t( FLT(1) / FLT(180) ),
+                                circular_vectoring_one_over_gain, hyperbolic_vectoring_one_over_gain } )
+            {
+                tables->const_multipliers[c] = make_const_multiplier_t( c );
+            }
+
+            it = shared_tables.insert( std::make_pair( key, tables ) ).first;
+        }
+
+        const SharedTables * tables = it->second;
+        _circular_atan_fxd             = tables->circular_atan_fxd;
+        _circular_rotation_gain_fxd    = tables->circular_rotation_gain_fxd;
+        _circular_vectoring_gain_fxd   = tables->circular_vectoring_gain_fxd;
+        _circular_angle_max_fxd        = tables->circular_angle_max_fxd;
+        _hyperbolic_atanh_fxd          = tables->hyperbolic_atanh_fxd;
+        _hyperbolic_rotation_gain_fxd  = tables->hyperbolic_rotation_gain_fxd;
+        _hyperbolic_vectoring_gain_fxd = tables->hyperbolic_vectoring_gain_fxd;
+        _hyperbolic_angle_max_fxd      = tables->hyperbolic_angle_max_fxd;
+        _exp_times_log2                = tables->exp_times_log2;
+        _exp_times_log2_b2             = tables->exp_times_log2_b2;
+        _exp_times_log2_b10            = tables->exp_times_log2_b10;
+        _base2_atanh_fxd               = tables->base2_atanh_fxd;
+        _base10_atanh_fxd              = tables->base10_atanh_fxd;
+        _const_multipliers             = &tables->const_multipliers;
+        _rcp_seed_fxd                  = tables->rcp_seed_fxd;
+        _rsqrt_seed_fxd                = tables->rsqrt_seed_fxd;
+        _rcbrt_seed_fxd                = tables->rcbrt_seed_fxd;
+    }
     if ( debug ) std::cout << "circular_angle_max_fxd="                 << std::setw(30) << _to_flt(_circular_angle_max_fxd, false, true) << "\n";
     if ( debug ) std::cout << "hyperbolic_angle_max_fxd="               << std::setw(30) << _to_flt(_hyperbolic_angle_max_fxd, false, true) << "\n";
-    
-    // calculate gain by plugging in x=1,y=0,z=0 into CORDICs
-    circular_rotation(    _one_fxd, _zero_fxd, _zero_fxd, _circular_rotation_gain_fxd,    yy, zz );
-    circular_vectoring(   _one_fxd, _zero_fxd, _zero_fxd, _circular_vectoring_gain_fxd,   yy, zz );
-    hyperbolic_rotation(  _one_fxd, _zero_fxd, _zero_fxd, _hyperbolic_rotation_gain_fxd,  yy, zz );
-    hyperbolic_vectoring( _one_fxd, _zero_fxd, _zero_fxd, _hyperbolic_vectoring_gain_fxd, yy, zz );
+
+    // for circular_rotation_dirs()
+    _circular_dirs_recode_i = _n + 1;
+    while( _circular_dirs_recode_i > 0 && _circular_atan_fxd[_circular_dirs_recode_i-1] == (_one_fxd >> (_circular_dirs_recode_i-1)) ) 
+    {
+        _circular_dirs_recode_i--;
+    }
 
     // calculate 1/gain_fxd which are the multiplication factors
     _circular_rotation_one_over_gain_fxd    = to_t( FLT(1) / _to_flt(_circular_rotation_gain_fxd,    false, true ),     false, true  );
@@ -1133,6 +1747,20 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _hyperbolic_rotation_one_over_gain      = to_t( FLT(1) / _to_flt(_hyperbolic_rotation_gain_fxd,  false, true ),     false, false );
     _hyperbolic_vectoring_one_over_gain_fxd = to_t( FLT(1) / _to_flt(_hyperbolic_vectoring_gain_fxd, false, true ),     false, true  );
     _hyperbolic_vectoring_one_over_gain     = to_t( FLT(1) / _to_flt(_hyperbolic_vectoring_gain_fxd, false, true ),     false, false );
+
+    // recodings that mulc() call sites use directly
+    _third_cm                              = &_const_multipliers->at( _third );
+    _neg_third_cm                          = &_const_multipliers->at( _neg_third );
+    _pi_cm                                 = &_const_multipliers->at( _pi );
+    _one_div_pi_cm                         = &_const_multipliers->at( _one_div_pi );
+    _log2_cm                               = &_const_multipliers->at( _log2 );
+    _log2_of_e_cm                          = &_const_multipliers->at( _log2_of_e );
+    _log2_of_2_cm                          = &_const_multipliers->at( _log2_of_2 );
+    _log2_of_10_cm                         = &_const_multipliers->at( _log2_of_10 );
+    _180_cm                                = &_const_multipliers->at( to_t( FLT(180) ) );
+    _one_div_180_cm                        = &_const_multipliers->at( to_t( FLT(1) / FLT(180) ) );
+    _circular_vectoring_one_over_gain_cm   = &_const_multipliers->at( _circular_vectoring_one_over_gain );
+    _hyperbolic_vectoring_one_over_gain_cm = &_const_multipliers->at( _hyperbolic_vectoring_one_over_gain );
     if ( debug ) printf( "circular_rotation_gain_fxd:                   %016" FMT_LLX "   %.30f\n",  _circular_rotation_gain_fxd, _to_flt(_circular_rotation_gain_fxd, false, true) );
     if ( debug ) printf( "circular_vectoring_gain_fxd:                  %016" FMT_LLX "   %.30f\n",  _circular_vectoring_gain_fxd, _to_flt(_circular_vectoring_gain_fxd, false, true) );
     if ( debug ) printf( "hyperbolic_rotation_gain_fxd:                 %016" FMT_LLX "   %.30f\n",  _hyperbolic_rotation_gain_fxd, _to_flt(_hyperbolic_rotation_gain_fxd, false, true) );
@@ -1141,251 +1769,1096 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     if ( debug ) printf( "circular_vectoring_one_over_gain_fxd:         %016" FMT_LLX "   %.30f\n",  _circular_vectoring_one_over_gain_fxd, _to_flt(_circular_vectoring_one_over_gain_fxd, false, true) );
     if ( debug ) printf( "hyperbolic_rotation_one_over_gain_fxd:        %016" FMT_LLX "   %.30f\n",  _hyperbolic_rotation_one_over_gain_fxd, _to_flt(_hyperbolic_rotation_one_over_gain_fxd, false, true) );
     if ( debug ) printf( "hyperbolic_vectoring_one_over_gain_fxd:       %016" FMT_LLX "   %.30f\n",  _hyperbolic_vectoring_one_over_gain_fxd, _to_flt(_hyperbolic_vectoring_one_over_gain_fxd, false, true) );
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-Cordic<T,FLT>::~Cordic( void )
+template< typename T, typename FLT, typename CORE >
+Cordic<T,FLT,CORE>::~Cordic( void )
 {
-    if ( logger != nullptr ) logger->cordic_destructed( this );
+    if ( logger_on() ) logger->cordic_destructed( this );
 
-    delete _circular_atan_fxd;
-    delete _hyperbolic_atanh_fxd;
+    // _circular_atan_fxd and _hyperbolic_atanh_fxd are shared, so they are not freed here;
+    // _memo_caches frees every thread's memo cache for this Cordic
+    delete[] _circular_radix4_scale_fxd;
+    delete[] _hyperbolic_radix4_scale_fxd;
+    delete[] _circular_lut;
+    delete[] _hyperbolic_lut;
+    delete[] _hyperbolic_neg_atanh_fxd;
+    delete[] _circular_skip_gain_fxd;
+    delete[] _hyperbolic_skip_gain_fxd;
+    delete[] _circular_tail_gain_fxd;
+    delete[] _hyperbolic_tail_gain_fxd;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) delete[] _lookup_tbl[i];
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::log_constructed( void )
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::log_constructed( void )
 {
-    if ( logger != nullptr ) logger->cordic_constructed( this, _int_w|_exp_w, _frac_w, _is_float, _guard_w, _n );
+    if ( logger_on() ) logger->cordic_constructed( this, _int_w|_exp_w, _frac_w, _is_float, _guard_w, _n );
 }
 
 //-----------------------------------------------------
-// Constants
+// Modes
 //-----------------------------------------------------
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::is_float( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::radix_set( uint32_t radix )
 {
-    return _is_float;
+    cassert( radix == 2 || radix == 4, "radix must be 2 or 4" );
+    _radix = radix;
+    if ( radix == 4 && _circular_radix4_scale_fxd == nullptr ) {
+        //-----------------------------------------------------
+        // Radix-4 step j rotates by d*4^-j with d in {-2,-1,0,1,2}, which has a 
+        // scale factor of sqrt(1 +/- (d*4^-j)^2) that depends on d.  The core routines 
+        // track the product of the reciprocals of the factors they actually used and 
+        // then apply it together with the radix-2 gain so that callers see the same 
+        // gain as in radix-2 mode.
+        //
+        // Convergence needs about half as many steps as radix-2.
+        // Hyperbolic radix-4 converges only for |z0| <= ~0.71, so beyond 
+        // _hyperbolic_radix4_angle_max_fxd we use the radix-2 loop.
+        //-----------------------------------------------------
+        _radix4_m = (_n + 1) / 2;
+        _circular_radix4_scale_fxd   = new T[2*(_radix4_m+1)];
+        _hyperbolic_radix4_scale_fxd = new T[2*(_radix4_m+1)];
+        for( uint32_t j = 0; j <= _radix4_m; j++ )
+        {
+            for( uint32_t d = 1; d <= 2; d++ )
+            {
+                FLT t  = FLT(d) * std::pow( FLT(4), -FLT(j) );
+                FLT t2 = t*t;
+                _circular_radix4_scale_fxd[2*j+d-1]   = to_t( FLT(1) / std::sqrt( FLT(1) + t2 ), false, true );
+                _hyperbolic_radix4_scale_fxd[2*j+d-1] = (j == 0) ? _one_fxd : to_t( FLT(1) / std::sqrt( FLT(1) - t2 ), false, true );
+            }
+        }
+        _hyperbolic_radix4_angle_max_fxd = to_t( 0.7, false, true );
+    }
+    _memo_epoch++;
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::int_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::radix( void ) const
 {
-    return _int_w;
+    return _radix;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::exp_w( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::lut_prefix_set( uint32_t k )
 {
-    return _exp_w;
+    cassert( k <= 16, "lut_prefix k must be <= 16" );
+    cassert( k == 0 || _hyperbolic_neg_iter_cnt == 0, "lut_prefix cannot be combined with hyperbolic_neg_iter" );
+    delete[] _circular_lut;
+    delete[] _hyperbolic_lut;
+    _circular_lut   = nullptr;
+    _hyperbolic_lut = nullptr;
+    _lut_prefix_w   = k;
+    _memo_epoch++;
+    unrolled_update();
+    if ( k == 0 ) return;
+
+    //-----------------------------------------------------
+    // The top k bits of z0+2^(e-1) pick a bucket of width 2^(e-k) where e=1 for circular
+    // and e=2 for hyperbolic.  Each entry holds the rotation of (1,0) by the bucket center
+    // angle a, prescaled by 1/gain_s where gain_s is the gain of iterations s..n.
+    // The remaining iterations s..n then rotate by the residual z0-a, so s is the 
+    // largest iteration whose remaining angle sum still covers half a bucket.
+    //-----------------------------------------------------
+    for( uint32_t is_circular = 0; is_circular < 2; is_circular++ )
+    {
+        const uint32_t e = is_circular ? 1 : 2;
+        cassert( (k+1) <= (_frac_guard_w+e), "lut_prefix k is too large for frac_w+guard_w" );
+        const T half_bucket = (_one_fxd << e) >> (k+1);
+        const T margin      = T(_n + 1);                      // one lsb of truncation per iteration
+        const T angle_max   = is_circular ? _circular_angle_max_fxd : _hyperbolic_angle_max_fxd;
+
+        // list of iterations in order
+        uint32_t   iter_cnt = 0;
+        uint32_t * iters    = new uint32_t[2*(_n+1)];
+        uint32_t   next_dup_i = 4;
+        for( uint32_t i = is_circular ? 0 : 1; i <= _n; i++ )
+        {
+            iters[iter_cnt++] = i;
+            if ( !is_circular && i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                iters[iter_cnt++] = i;
+            }
+        }
+
+        // find s by summing angles backward
+        uint32_t s     = iters[iter_cnt-1];
+        T        sum   = 0;
+        FLT      gain_s = 1.0;
+        for( int32_t j = int32_t(iter_cnt)-1; j >= 0; j-- )
+        {
+            const uint32_t i = iters[j];
+            sum += is_circular ? _circular_atan_fxd[i] : _hyperbolic_atanh_fxd[i];
+            if ( sum < (half_bucket + margin) ) continue;
+            if ( j > 0 && iters[j-1] == i ) continue;          // don't split a repeated hyperbolic iteration
+            s = i;
+        }
+        for( uint32_t j = 0; j < iter_cnt; j++ )
+        {
+            const uint32_t i = iters[j];
+            if ( i < s ) continue;
+            const FLT t2 = std::pow( FLT(2), -2*FLT(i) );
+            gain_s *= std::sqrt( is_circular ? (FLT(1) + t2) : (FLT(1) - t2) );
+        }
+        delete[] iters;
+
+        const uint32_t entry_cnt = 1 << k;
+        LutEntry * lut = new LutEntry[entry_cnt];
+        for( uint32_t b = 0; b < entry_cnt; b++ )
+        {
+            const FLT a = -std::pow( FLT(2), FLT(e-1) ) + (FLT(b) + FLT(0.5)) * std::pow( FLT(2), FLT(e) - FLT(k) );
+            lut[b].a = to_t( a, false, true );
+            if ( (lut[b].a < 0 ? -lut[b].a : lut[b].a) > (angle_max + half_bucket) ) {
+                // never used, and cosh(a) might not fit
+                lut[b].c = 0;
+                lut[b].s = 0;
+                continue;
+            }
+            lut[b].c = to_t( (is_circular ? std::cos( a ) : std::cosh( a )) / gain_s, false, true );
+            lut[b].s = to_t( (is_circular ? std::sin( a ) : std::sinh( a )) / gain_s, false, true );
+        }
+        if ( debug ) std::cout << "lut_prefix_set: k=" << k << " is_circular=" << is_circular << " start_i=" << s << " gain_s=" << gain_s << "\n";
+
+        if ( is_circular ) {
+            _circular_lut           = lut;
+            _circular_lut_start_i   = s;
+        } else {
+            _hyperbolic_lut         = lut;
+            _hyperbolic_lut_start_i = s;
+        }
+    }
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::frac_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::lut_prefix( void ) const
 {
-    return _frac_w;
+    return _lut_prefix_w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::guard_w( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_finish_set( bool en )
 {
-    return _guard_w;
+    //-----------------------------------------------------
+    // After iteration i the residual angle r is at most about 2^(-i).
+    // sin(r) = r - r^3/6 and cos(r) = 1 - r^2/2 (likewise sinh, cosh, atan, atanh),
+    // so stopping at i = n/2+1 leaves an error of about 2^(-n-3) in the linear step.
+    //-----------------------------------------------------
+    _linear_finish   = en;
+    _memo_epoch++;
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::linear_finish( void ) const
 {
-    return _w;
+    return _linear_finish;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::n( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_neg_iter_set( uint32_t k )
 {
-    return _n;
+    cassert( k <= 8, "hyperbolic_neg_iter k must be <= 8" );
+    cassert( k == 0 || _lut_prefix_w == 0, "hyperbolic_neg_iter cannot be combined with lut_prefix" );
+    delete[] _hyperbolic_neg_atanh_fxd;
+    _hyperbolic_neg_atanh_fxd = nullptr;
+    _hyperbolic_neg_iter_cnt  = k;
+    _memo_epoch++;
+    unrolled_update();
+    if ( k == 0 ) return;
+
+    //-----------------------------------------------------
+    // Iteration i <= 0 rotates by atanh(1-2^(i-2)) with a scale factor of sqrt(1-(1-2^(i-2))^2) (Hu, Harber and Bass).
+    // Each angle is at most about 0.35 more than the one after it, so the
+    // usual convergence argument holds and the residual after i=0 is within
+    // the radix-2 range.  The gain of these iterations is not folded into
+    // the radix-2 gain; hyperbolic_rotation() prescales x0 and y0 by its reciprocal 
+    // instead, so callers see the same gain as before.
+    //-----------------------------------------------------
+    auto to_fxd = [&]( FLT v ) -> T { return T( std::round( v * FLT(_one_fxd) ) ); };  // to_t() stops at 4 for floating-point
+    _hyperbolic_neg_atanh_fxd = new T[k];
+    FLT gain  = 1.0;
+    FLT a_sum = 0.0;
+    for( uint32_t j = 0; j < k; j++ )
+    {
+        const int32_t i = int32_t(j) + 1 - int32_t(k);
+        const FLT     f = FLT(1) - std::pow( FLT(2), FLT(i-2) );
+        const FLT     a = std::atanh( f );
+        _hyperbolic_neg_atanh_fxd[j] = to_fxd( a );
+        gain  *= std::sqrt( FLT(1) - f*f );
+        a_sum += a;
+    }
+    const FLT angle_max = a_sum + _to_flt( _hyperbolic_angle_max_fxd, false, true );
+    const FLT v_max     = std::max( FLT(4) / gain, std::exp( angle_max ) );  // largest |x| or |y| along the way
+    cassert( v_max < std::ldexp( FLT(1), int32_t(8*sizeof(T)) - 2 - int32_t(_frac_guard_w) ), 
+             "hyperbolic_neg_iter k=" + std::to_string(k) + " needs more integer bits than T has; reduce k or frac_w+guard_w" );
+    _hyperbolic_neg_one_over_gain_fxd = to_fxd( FLT(1) / gain );
+    _hyperbolic_neg_angle_max_fxd     = to_fxd( angle_max );
+
+    // exp(-a) loses about a/log(2) bits to the fixed-point fraction, 
+    // so exp() reduces anything below -log(2) as before
+    const FLT exp_min = FLT(M_LN2);
+    _hyperbolic_neg_exp_min_fxd = to_fxd( exp_min );
+    if ( debug ) std::cout << "hyperbolic_neg_iter_set: k=" << k << " gain=" << gain << " angle_max=" << angle_max << " exp_min=" << exp_min << "\n";
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::maxint( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::hyperbolic_neg_iter( void ) const
 {
-    return _maxint;
+    return _hyperbolic_neg_iter_cnt;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::max( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::small_angle_skip_set( bool en )
 {
-    _log_1f( push_constant, to_flt(_max) );
-    return _max;
+    _small_angle_skip = en;
+    if ( en && _circular_skip_gain_fxd == nullptr ) {
+        //-----------------------------------------------------
+        // Once the angle is below 2^-s, iterations 0..s-1 would only rotate 
+        // back and forth, but they still scale x and y.  So the core routines
+        // start at s and multiply by the gain those iterations would have had.
+        //-----------------------------------------------------
+        _circular_skip_gain_fxd   = new T[_n+2];
+        _hyperbolic_skip_gain_fxd = new T[_n+2];
+        FLT      c_gain     = 1.0;
+        FLT      h_gain     = 1.0;
+        uint32_t next_dup_i = 4;
+        for( uint32_t s = 0; s <= _n+1; s++ )
+        {
+            _circular_skip_gain_fxd[s]   = to_t( c_gain, false, true );
+            _hyperbolic_skip_gain_fxd[s] = to_t( h_gain, false, true );
+            const FLT t2 = std::pow( FLT(2), -2*FLT(s) );
+            c_gain *= std::sqrt( FLT(1) + t2 );
+            if ( s == 0 ) continue;
+            h_gain *= std::sqrt( FLT(1) - t2 );
+            if ( s == next_dup_i ) {
+                next_dup_i = 3*s + 1;
+                h_gain *= std::sqrt( FLT(1) - t2 );
+            }
+        }
+    }
+    _memo_epoch++;
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::min( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::small_angle_skip( void ) const
 {
-    _log_1f( push_constant, to_flt(_min) );
-    return _min;
+    return _small_angle_skip;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::denorm_min( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::early_exit_set( bool en )
 {
-    return min();
+    _early_exit = en;
+    if ( en && _circular_tail_gain_fxd == nullptr ) {
+        //-----------------------------------------------------
+        // Once y (vectoring) or z (rotation) is exactly 0, the result is exact except that 
+        // iterations i..n would still have scaled x and y.  Linear mode has no gain.
+        //-----------------------------------------------------
+        _circular_tail_gain_fxd   = new T[_n+2];
+        _hyperbolic_tail_gain_fxd = new T[_n+2];
+        FLT c_gain = 1.0;
+        FLT h_gain = 1.0;
+        _circular_tail_gain_fxd[_n+1]   = _one_fxd;
+        _hyperbolic_tail_gain_fxd[_n+1] = _one_fxd;
+        for( int32_t i = int32_t(_n); i >= 0; i-- )
+        {
+            const FLT t2 = std::pow( FLT(2), -2*FLT(i) );
+            c_gain *= std::sqrt( FLT(1) + t2 );
+            if ( i != 0 ) {
+                uint32_t dup_i = 4;
+                while( dup_i < uint32_t(i) ) dup_i = 3*dup_i + 1;
+                h_gain *= std::sqrt( FLT(1) - t2 );
+                if ( dup_i == uint32_t(i) ) h_gain *= std::sqrt( FLT(1) - t2 );
+            }
+            _circular_tail_gain_fxd[i]   = to_t( c_gain, false, true );
+            _hyperbolic_tail_gain_fxd[i] = to_t( h_gain, false, true );
+        }
+    }
+    _memo_epoch++;
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::lowest( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::early_exit( void ) const
 {
-    _log_1f( push_constant, to_flt(_lowest) );
-    return _lowest;
+    return _early_exit;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::epsilon( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::small_angle_start( T a, const T& b, uint32_t n ) const
 {
-    return min();
+    //-----------------------------------------------------
+    // |a| < 2^(msb(a)+1) and b >= 2^msb(b), so |a/b| < 2^-s for s = msb(b)-msb(a)-1.
+    // Iterations s..n together cover angles up to about 2^(1-s), so starting at s converges.
+    //-----------------------------------------------------
+    if ( a < 0 ) a = -a;
+    const int32_t s = (a == 0) ? int32_t(n) : std::min( int32_t(n), msb( b ) - msb( a ) - 1 );
+    return (s >= int32_t(SMALL_ANGLE_SKIP_MIN)) ? uint32_t(s) : 0;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::round_error( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::modes_are_default( void ) const
 {
-    return min();
+    return _radix == 2 && _lut_prefix_w == 0 && !_linear_finish && _hyperbolic_neg_iter_cnt == 0 && !_small_angle_skip && !_early_exit && _n_for_is_default;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::zero( void ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::unrolled_update( void )
 {
-    _log_1f( push_constant, to_flt(_zero) );
-    return _zero;
+    _unrolled = !std::is_void<CORE>::value && modes_are_default();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::one( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::n_for_set( OP op, uint32_t n )
 {
-    _log_1f( push_constant, to_flt(_one) ); 
-    return _one;
+    cassert( uint32_t(op) < OP_cnt, "n_for_set: bad op" );
+    cassert( n >= (_n+1)/2 && n <= _n, "n_for_set: n must be in the range (n+1)/2 .. n, got " + std::to_string(n) + 
+                                       " for " + op_to_str( uint16_t(op) ) );
+    _n_for[uint32_t(op)] = n;
+    _n_for_is_default = true;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) _n_for_is_default = _n_for_is_default && _n_for[i] == _n;
+    _memo_epoch++;
+    unrolled_update();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg_one( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::n_for( OP op ) const
 {
-    _log_1f( push_constant, to_flt(_neg_one) ); 
-    return _neg_one;
+    return _n_for[uint32_t(op)];
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::two( void ) const
+template< typename T, typename FLT, typename CORE >
+uint32_t Cordic<T,FLT,CORE>::n_for_calibrate( OP op, FLT max_err, const FLT * xs, size_t cnt, const FLT * ys )
 {
-    _log_1f( push_constant, to_flt(_two) ); 
-    return _two;
+    //-----------------------------------------------------
+    // Error is not quite monotonic in n, so walk down from n
+    // and stop at the first count that misses.
+    //-----------------------------------------------------
+    uint32_t best = _n;
+    for( uint32_t m = _n; m >= (_n+1)/2; m-- )
+    {
+        n_for_set( op, m );
+        FLT worst = 0;
+        for( size_t k = 0; k < cnt; k++ )
+        {
+            FLT got, ref;
+            cassert( n_for_eval( op, xs[k], (ys != nullptr) ? ys[k] : FLT(0), got, ref ), 
+                     "n_for_calibrate: no reference function for " + op_to_str( uint16_t(op) ) );
+            if ( !std::isfinite( ref ) ) continue;
+            const int32_t e   = (std::abs( ref ) < FLT(1)) ? 0 : int32_t( std::ilogb( ref ) );
+            const FLT     err = std::isnan( got ) ? FLT(INFINITY) : (std::abs( got - ref ) / std::ldexp( FLT(1), e - int32_t(_frac_w) ));
+            if ( err > worst ) worst = err;
+        }
+        if ( debug ) std::cout << "n_for_calibrate: op=" << op_to_str( uint16_t(op) ) << " n=" << m << " worst_err=" << worst << "\n";
+        if ( worst > max_err ) break;
+        best = m;
+        if ( m == 0 ) break;
+    }
+    n_for_set( op, best );
+    return best;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::half( void ) const
+template< typename T, typename FLT, typename CORE >
+bool Cordic<T,FLT,CORE>::n_for_eval( OP op, FLT x, FLT y, FLT& got, FLT& ref ) const
 {
-    _log_1f( push_constant, to_flt(_half) ); 
-    return _half;
+    const T xt = to_t( x );
+    const T yt = to_t( y );
+    x = to_flt( xt );                                                   // what the format can hold
+    y = to_flt( yt );
+    T r;
+    switch( op )
+    {
+        case OP::mul:    r = mul( xt, yt );     ref = x * y;                            break;
+        case OP::div:    r = div( xt, yt );     ref = x / y;                            break;
+        case OP::rcp:    r = rcp( xt );         ref = FLT(1) / x;                       break;
+        case OP::sqrt:   r = sqrt( xt );        ref = std::sqrt( x );                   break;
+        case OP::rsqrt:  r = rsqrt( xt );       ref = FLT(1) / std::sqrt( x );          break;
+        case OP::cbrt:   r = cbrt( xt );        ref = std::cbrt( x );                   break;
+        case OP::rcbrt:  r = rcbrt( xt );       ref = FLT(1) / std::cbrt( x );          break;
+        case OP::exp:    r = exp( xt );         ref = std::exp( x );                    break;
+        case OP::expm1:  r = expm1( xt );       ref = std::expm1( x );                  break;
+        case OP::exp2:   r = exp2( xt );        ref = std::exp2( x );                   break;
+        case OP::exp10:  r = exp10( xt );       ref = std::pow( FLT(10), x );           break;
+        case OP::pow:    r = pow( xt, yt );     ref = std::pow( x, y );                 break;
+        case OP::log:    r = log( xt );         ref = std::log( x );                    break;
+        case OP::log1p:  r = log1p( xt );       ref = std::log1p( x );                  break;
+        case OP::log2:   r = log2( xt );        ref = std::log2( x );                   break;
+        case OP::log10:  r = log10( xt );       ref = std::log10( x );                  break;
+        case OP::sin:    r = sin( xt );         ref = std::sin( x );                    break;
+        case OP::cos:    r = cos( xt );         ref = std::cos( x );                    break;
+        case OP::tan:    r = tan( xt );         ref = std::tan( x );                    break;
+        case OP::sinpi:  r = sinpi( xt );       ref = std::sin( FLT(M_PI) * x );        break;
+        case OP::cospi:  r = cospi( xt );       ref = std::cos( FLT(M_PI) * x );        break;
+        case OP::tanpi:  r = tanpi( xt );       ref = std::tan( FLT(M_PI) * x );        break;
+        case OP::asin:   r = asin( xt );        ref = std::asin( x );                   break;
+        case OP::acos:   r = acos( xt );        ref = std::acos( x );                   break;
+        case OP::atan:   r = atan( xt );        ref = std::atan( x );                   break;
+        case OP::atan2:  r = atan2( xt, yt );   ref = std::atan2( x, y );               break;
+        case OP::hypot:  r = hypot( xt, yt );   ref = std::hypot( x, y );               break;
+        case OP::sinh:   r = sinh( xt );        ref = std::sinh( x );                   break;
+        case OP::cosh:   r = cosh( xt );        ref = std::cosh( x );                   break;
+        case OP::tanh:   r = tanh( xt );        ref = std::tanh( x );                   break;
+        case OP::asinh:  r = asinh( xt );       ref = std::asinh( x );                  break;
+        case OP::acosh:  r = acosh( xt );       ref = std::acosh( x );                  break;
+        case OP::atanh:  r = atanh( xt );       ref = std::atanh( x );                  break;
+        default:                                                                        return false;
+    }
+    got = to_flt( r );
+    return true;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::quarter( void ) const
+template< typename T, typename FLT, typename CORE >
+bool Cordic<T,FLT,CORE>::lookup_supported( OP op )
 {
-    _log_1f( push_constant, to_flt(_quarter) ); 
-    return _quarter;
+    switch( op )
+    {
+        case OP::rcp:   case OP::sqrt:  case OP::rsqrt: case OP::cbrt:  case OP::rcbrt:
+        case OP::exp:   case OP::expm1: case OP::exp2:  case OP::exp10:
+        case OP::log:   case OP::log1p: case OP::log2:  case OP::log10:
+        case OP::sin:   case OP::cos:   case OP::tan:   case OP::sinpi: case OP::cospi: case OP::tanpi:
+        case OP::asin:  case OP::acos:  case OP::atan:
+        case OP::sinh:  case OP::cosh:  case OP::tanh:  case OP::asinh: case OP::acosh: case OP::atanh:
+            return true;
+
+        default:
+            return false;
+    }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::lookup_w( void ) const
 {
-    _log_1f( push_constant, to_flt(_sqrt2) ); 
-    return _sqrt2;
+    return _w - _guard_w;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt2_div_2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::lookup_mag( const T& i ) const
 {
-    _log_1f( push_constant, to_flt(_sqrt2_div_2) ); 
-    return _sqrt2_div_2;
+    return _is_float ? (i & ~(T(1) << (lookup_w()-1))) : ((i < 0) ? -i : i);
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::lookup_tables_build( const std::vector<OP>& ops, FLT abs_min, FLT abs_max, uint32_t thread_cnt )
 {
-    _log_1f( push_constant, to_flt(_pi) ); 
-    return _pi;
+    const uint32_t vw = lookup_w();
+    cassert( vw <= 16, "lookup_tables_build: 1+int_exp_w+frac_w must be <= 16, got " + std::to_string(vw) );
+    if ( thread_cnt == 0 ) thread_cnt = std::thread::hardware_concurrency();
+    if ( thread_cnt == 0 ) thread_cnt = 1;
+    const size_t cnt = size_t(1) << vw;
+
+    // the inputs in range have contiguous magnitudes 
+    //
+    const bool saved_logger_suppressed = logger_suppressed;              // don't log the build on this thread or the build threads
+    logger_suppressed = true;
+    std::vector<T> xs( cnt );
+    T mag_min = std::numeric_limits<T>::max();
+    T mag_max = -1;
+    for( size_t i = 0; i < cnt; i++ )
+    {
+        T ii = T(i);
+        if ( !_is_float && (ii >> (vw-1)) != 0 ) ii -= T(1) << vw;      // sign-extend fixed-point
+        xs[i] = ii << _guard_w;
+        if ( !isfinite( xs[i] ) ) continue;
+        const FLT ax = std::abs( to_flt( xs[i] ) );
+        if ( ax < abs_min || ax > abs_max ) continue;
+        mag_min = std::min( mag_min, lookup_mag( ii ) );
+        mag_max = std::max( mag_max, lookup_mag( ii ) );
+    }
+
+    for( OP op: ops )
+    {
+        cassert( lookup_supported( op ), "lookup_tables_build: no table support for " + op_to_str( uint16_t(op) ) );
+        delete[] _lookup_tbl[uint32_t(op)];                             // so that the build does not use it
+        _lookup_tbl[uint32_t(op)] = nullptr;
+        T * tbl = new T[cnt];
+        std::vector<std::thread> threads;
+        const size_t per = (cnt + thread_cnt - 1) / thread_cnt;
+        for( size_t b = 0; b < cnt; b += per )
+        {
+            const size_t e = std::min( b + per, cnt );
+            threads.push_back( std::thread( [this, op, tbl, &xs, mag_min, mag_max, b, e]( void ) 
+            {
+                logger_suppressed = true;
+                for( size_t i = b; i < e; i++ )
+                {
+                    const T mag = lookup_mag( xs[i] >> _guard_w );
+                    tbl[i] = (mag >= mag_min && mag <= mag_max) ? unary_eval( op, xs[i] ) : xs[i];  // lookup() never returns the latter
+                }
+            } ) );
+        }
+        for( auto& t: threads ) t.join();
+        _lookup_tbl[uint32_t(op)]     = tbl;
+        _lookup_mag_min[uint32_t(op)] = mag_min;
+        _lookup_mag_max[uint32_t(op)] = mag_max;
+        _lookup_epoch[uint32_t(op)]   = _memo_epoch;
+    }
+    _lookup_rounding_mode = _rounding_mode;
+    logger_suppressed = saved_logger_suppressed;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tau( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::lookup_tables_clear( void )
 {
-    _log_1f( push_constant, to_flt(_tau) ); 
-    return _tau;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) 
+    {
+        delete[] _lookup_tbl[i];
+        _lookup_tbl[i] = nullptr;
+    }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi_div_2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::lookup_table_has( OP op ) const
 {
-    _log_1f( push_constant, to_flt(_pi_div_2) ); 
-    return _pi_div_2;
+    return _lookup_tbl[uint32_t(op)] != nullptr;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi_div_4( void ) const
+template< typename T, typename FLT, typename CORE >
+bool Cordic<T,FLT,CORE>::lookup_tables_save( std::string file_name ) const
 {
-    _log_1f( push_constant, to_flt(_pi_div_4) ); 
-    return _pi_div_4;
+    std::ofstream out( file_name, std::ios::binary );
+    if ( !out ) return false;
+    uint32_t tbl_cnt = 0;
+    for( uint32_t i = 0; i < OP_cnt; i++ ) tbl_cnt += _lookup_tbl[i] != nullptr;
+    const uint32_t hdr[] = { 0x4c555443, uint32_t(sizeof(T)), uint32_t(_is_float), _is_float ? _exp_w : _int_w, _frac_w, _guard_w, 
+                             _n, uint32_t(_lookup_rounding_mode), tbl_cnt };
+    out.write( reinterpret_cast<const char *>( hdr ), sizeof(hdr) );
+    const size_t cnt = size_t(1) << lookup_w();
+    for( uint32_t i = 0; i < OP_cnt; i++ )
+    {
+        if ( _lookup_tbl[i] == nullptr ) continue;
+        out.write( reinterpret_cast<const char *>( &i ), sizeof(i) );
+        out.write( reinterpret_cast<const char *>( &_lookup_mag_min[i] ), sizeof(T) );
+        out.write( reinterpret_cast<const char *>( &_lookup_mag_max[i] ), sizeof(T) );
+        out.write( reinterpret_cast<const char *>( _lookup_tbl[i] ), cnt*sizeof(T) );
+    }
+    return bool(out);
+}
+
+template< typename T, typename FLT, typename CORE >
+bool Cordic<T,FLT,CORE>::lookup_tables_load( std::string file_name )
+{
+    std::ifstream in( file_name, std::ios::binary );
+    if ( !in ) return false;
+    uint32_t hdr[9];
+    if ( !in.read( reinterpret_cast<char *>( hdr ), sizeof(hdr) ) ) return false;
+    if ( hdr[0] != 0x4c555443 || hdr[1] != sizeof(T) || hdr[2] != uint32_t(_is_float) || hdr[3] != (_is_float ? _exp_w : _int_w) ||
+         hdr[4] != _frac_w || hdr[5] != _guard_w || hdr[6] != _n || lookup_w() > 16 ) return false;
+    const size_t cnt = size_t(1) << lookup_w();
+    T * tbls[OP_cnt] = {};
+    T   mag_min[OP_cnt];
+    T   mag_max[OP_cnt];
+    bool ok = true;
+    for( uint32_t k = 0; ok && k < hdr[8]; k++ )
+    {
+        uint32_t i;
+        ok = in.read( reinterpret_cast<char *>( &i ), sizeof(i) ) && i < OP_cnt && tbls[i] == nullptr && lookup_supported( OP(i) );
+        if ( ok ) {
+            tbls[i] = new T[cnt];
+            ok = in.read( reinterpret_cast<char *>( &mag_min[i] ), sizeof(T) ) && 
+                 in.read( reinterpret_cast<char *>( &mag_max[i] ), sizeof(T) ) &&
+                 in.read( reinterpret_cast<char *>( tbls[i] ), cnt*sizeof(T) );
+        }
+    }
+    if ( ok ) {
+        for( uint32_t i = 0; i < OP_cnt; i++ ) 
+        {
+            if ( tbls[i] == nullptr ) continue;
+            delete[] _lookup_tbl[i];
+            _lookup_tbl[i]     = tbls[i];
+            _lookup_mag_min[i] = mag_min[i];
+            _lookup_mag_max[i] = mag_max[i];
+            _lookup_epoch[i]   = _memo_epoch;
+        }
+        _lookup_rounding_mode = int(hdr[7]);
+    } else {
+        for( uint32_t i = 0; i < OP_cnt; i++ ) delete[] tbls[i];
+    }
+    return ok;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::one_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::lookup( OP op, const T& x, T& r ) const
 {
-    _log_1f( push_constant, to_flt(_one_div_pi) ); 
-    return _one_div_pi;
+    const T * tbl = _lookup_tbl[uint32_t(op)];
+    if ( tbl == nullptr || n_for_owner != nullptr ||                    // no table or nested inside another op
+         _lookup_epoch[uint32_t(op)] != _memo_epoch ||                  // modes changed since the build
+         (x & _guard_mask) != 0 || _rounding_mode != _lookup_rounding_mode ) return false;
+    const uint32_t vw = lookup_w();
+    const T i = x >> _guard_w;
+    if ( _is_float ? (i >> vw) != 0 : (i >> (vw-1)) != 0 && (i >> (vw-1)) != -1 ) return false;  // not a valid encoding
+    const T mag = lookup_mag( i );
+    if ( mag < _lookup_mag_min[uint32_t(op)] || mag > _lookup_mag_max[uint32_t(op)] ) return false;  // not tabled
+    if ( logger_on() ) logger->op1( uint16_t(op), &x );
+    r = tbl[size_t(i) & ((size_t(1) << vw) - 1)];
+    return true;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::two_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::unary_eval( OP op, const T& x ) const
 {
-    _log_1f( push_constant, to_flt(_two_div_pi) ); 
-    return _two_div_pi;
+    switch( op )
+    {
+        case OP::rcp:    return rcp( x );
+        case OP::sqrt:   return sqrt( x );
+        case OP::rsqrt:  return rsqrt( x );
+        case OP::cbrt:   return cbrt( x );
+        case OP::rcbrt:  return rcbrt( x );
+        case OP::exp:    return exp( x );
+        case OP::expm1:  return expm1( x );
+        case OP::exp2:   return exp2( x );
+        case OP::exp10:  return exp10( x );
+        case OP::log:    return log( x );
+        case OP::log1p:  return log1p( x );
+        case OP::log2:   return log2( x );
+        case OP::log10:  return log10( x );
+        case OP::sin:    return sin( x );
+        case OP::cos:    return cos( x );
+        case OP::tan:    return tan( x );
+        case OP::sinpi:  return sinpi( x );
+        case OP::cospi:  return cospi( x );
+        case OP::tanpi:  return tanpi( x );
+        case OP::asin:   return asin( x );
+        case OP::acos:   return acos( x );
+        case OP::atan:   return atan( x );
+        case OP::sinh:   return sinh( x );
+        case OP::cosh:   return cosh( x );
+        case OP::tanh:   return tanh( x );
+        case OP::asinh:  return asinh( x );
+        case OP::acosh:  return acosh( x );
+        case OP::atanh:  return atanh( x );
+        default:         cassert( false, "unary_eval: unsupported op " + op_to_str( uint16_t(op) ) ); return x;
+    }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::four_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::memo_cache_set( uint32_t entry_cnt )
 {
-    _log_1f( push_constant, to_flt(_four_div_pi) ); 
-    return _four_div_pi;
+    cassert( (entry_cnt & (entry_cnt-1)) == 0, "memo_cache_set: entry_cnt must be 0 or a power of 2, got " + std::to_string(entry_cnt) );
+    _memo_entry_cnt = entry_cnt;
+    _memo_hit_cnt   = 0;
+    _memo_miss_cnt  = 0;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::e( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::memo_cache( void ) const
+{
+    return _memo_entry_cnt;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint64_t Cordic<T,FLT,CORE>::memo_cache_hit_cnt( void ) const
+{
+    return _memo_hit_cnt.load( std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint64_t Cordic<T,FLT,CORE>::memo_cache_miss_cnt( void ) const
+{
+    return _memo_miss_cnt.load( std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::MemoCache& Cordic<T,FLT,CORE>::memo_cache_get( void ) const
+{
+    //-----------------------------------------------------
+    // The slots are fully associative, so up to MEMO_SLOT_CNT Cordics
+    // can be used alternately on a thread without taking _memo_mutex.
+    //-----------------------------------------------------
+    for( uint32_t i = 0; i < MEMO_SLOT_CNT; i++ )
+    {
+        if ( memo_slots[i].id == _memo_id ) return *memo_slots[i].cache;
+    }
+
+    std::lock_guard<std::mutex> lock( _memo_mutex );
+    std::unique_ptr<MemoCache>& cache = _memo_caches[std::this_thread::get_id()];
+    if ( !cache ) cache.reset( new MemoCache{ 0, {} } );
+    MemoSlot& slot = memo_slots[memo_slot_next];
+    memo_slot_next = (memo_slot_next + 1) % MEMO_SLOT_CNT;
+    slot.id    = _memo_id;
+    slot.cache = cache.get();
+    return *slot.cache;
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename F >
+inline T Cordic<T,FLT,CORE>::memo( OP op, const T& x, const T& y, F compute ) const
+{
+    MemoCache& cache = memo_cache_get();
+    const size_t set_cnt = _memo_entry_cnt;
+    if ( cache.epoch != _memo_epoch || cache.entries.size() != set_cnt*OP_cnt ) {
+        cache.epoch = _memo_epoch;
+        cache.entries.assign( set_cnt*OP_cnt, MemoEntry{ T(0), T(0), T(0), false } );
+    }
+    const uint64_t h = (uint64_t(x) ^ uint64_t(y) * 0xc2b2ae3d27d4eb4fULL) * 0x9e3779b97f4a7c15ULL;  // upper bits are well mixed
+    MemoEntry& e = cache.entries[size_t(op)*set_cnt + ((h >> 32) & (set_cnt-1))];
+    const bool hit = e.valid && e.x == x && e.y == y;
+    if ( hit ) {
+        _memo_hit_cnt.fetch_add( 1, std::memory_order_relaxed );
+    } else {
+        e.r     = compute();                                            // nested calls don't touch the cache
+        e.x     = x;
+        e.y     = y;
+        e.valid = true;
+        _memo_miss_cnt.fetch_add( 1, std::memory_order_relaxed );
+    }
+    if ( logger_on() ) logger->memo_lookup( this, uint16_t(op), hit );
+    return e.r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline Cordic<T,FLT,CORE>::NForScope::NForScope( const Cordic * cordic, OP op )
+{
+    is_outermost = n_for_owner == nullptr;
+    if ( is_outermost ) {
+        n_for_owner = cordic;
+        n_for_n     = cordic->_n_for[uint32_t(op)];
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline Cordic<T,FLT,CORE>::NForScope::~NForScope()
+{
+    if ( is_outermost ) n_for_owner = nullptr;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::iter_n( bool is_linear ) const
+{
+    const uint32_t n = (n_for_owner == this) ? n_for_n : _n;
+    return (is_linear || !_linear_finish) ? n : (n/2 + 1);
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::native_muldiv_set( bool en )
+{
+    _native_muldiv = en;
+    _memo_epoch++;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::native_muldiv( void ) const
+{
+    return _native_muldiv;
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::div_engine_set( DIV_ENGINE e )
+{
+    cassert( e == DIV_ENGINE::CORDIC || _is_float, "div_engine other than CORDIC requires floating-point" );
+    cassert( e == DIV_ENGINE::CORDIC || _frac_guard_w >= 8, "div_engine other than CORDIC requires frac_w+guard_w >= 8" );
+    _div_engine = e;
+    _memo_epoch++;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::DIV_ENGINE Cordic<T,FLT,CORE>::div_engine( void ) const
+{
+    return _div_engine;
+}
+
+template< typename T, typename FLT, typename CORE >
+uint32_t Cordic<T,FLT,CORE>::div_engine_steps( void ) const
+{
+    switch( _div_engine )
+    {
+        case DIV_ENGINE::SRT4:          return (_frac_guard_w + 5) / 2;
+        case DIV_ENGINE::NEWTON:        return 2*_rcp_iter_cnt + 1 + 2;        // x*r and r*e per iteration, then y*r, then div_fix_up()
+        case DIV_ENGINE::GOLDSCHMIDT:   return _rcp_iter_cnt + 2 + 2;          // n*f and d*f are independent, then div_fix_up()
+        default:                        return _n + 1;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+uint32_t Cordic<T,FLT,CORE>::div_engine_sqrt_steps( void ) const
+{
+    switch( _div_engine )
+    {
+        case DIV_ENGINE::SRT4:          return (_frac_guard_w + 2) / 2;
+        case DIV_ENGINE::NEWTON:        return 3*_rsqrt_iter_cnt + 1 + 2;      // r*r, a*r^2, r*() per iteration, then a*r, then sqrt_fix_up()
+        case DIV_ENGINE::GOLDSCHMIDT:   return 2*_rsqrt_iter_cnt + 2 + 2;      // g*h then g*e and h*e together, plus a*r and sqrt_fix_up()
+        default:
+        {
+            uint32_t cnt = _n + 1;                                             // the last one is the 1/gain multiply
+            for( uint32_t i = 4; i <= _n; i = 3*i + 1 ) cnt++;                 // repeated hyperbolic iterations
+            return cnt;
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+std::string Cordic<T,FLT,CORE>::to_str( DIV_ENGINE e )
+{
+    switch( e )
+    {
+        case DIV_ENGINE::CORDIC:        return "CORDIC";
+        case DIV_ENGINE::SRT4:          return "SRT4";
+        case DIV_ENGINE::NEWTON:        return "NEWTON";
+        case DIV_ENGINE::GOLDSCHMIDT:   return "GOLDSCHMIDT";
+        default:                        return "<unknown>";
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::lut_prefix( bool is_circular, const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    //-----------------------------------------------------
+    // The usual callers pass x0=1/gain and y0=0 (sincos), or x0=y0=1/gain (exp), 
+    // and those need no multiplies.  Anything else is rotated by the table entry 
+    // and rescaled by gain using mul_fxd().
+    //-----------------------------------------------------
+    const uint32_t   e   = is_circular ? 1 : 2;
+    const LutEntry * lut = is_circular ? _circular_lut : _hyperbolic_lut;
+    const LutEntry&  le  = lut[(z0 + (_one_fxd << (e-1))) >> (_frac_guard_w + e - _lut_prefix_w)];
+    const T one_over_gain = is_circular ? _circular_rotation_one_over_gain_fxd : _hyperbolic_rotation_one_over_gain_fxd;
+    if ( x0 == one_over_gain && y0 == 0 ) {
+        x = le.c;
+        y = le.s;
+    } else if ( !is_circular && x0 == one_over_gain && y0 == x0 ) {
+        x = le.c + le.s;
+        y = x;
+    } else if ( is_circular ) {
+        x = mul_fxd( mul_fxd( x0, le.c ) - mul_fxd( y0, le.s ), _circular_rotation_gain_fxd );
+        y = mul_fxd( mul_fxd( y0, le.c ) + mul_fxd( x0, le.s ), _circular_rotation_gain_fxd );
+    } else {
+        x = mul_fxd( mul_fxd( x0, le.c ) + mul_fxd( y0, le.s ), _hyperbolic_rotation_gain_fxd );
+        y = mul_fxd( mul_fxd( y0, le.c ) + mul_fxd( x0, le.s ), _hyperbolic_rotation_gain_fxd );
+    }
+    z = z0 - le.a;
+    return is_circular ? _circular_lut_start_i : _hyperbolic_lut_start_i;
+}
+
+//-----------------------------------------------------
+// Constants
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::is_float( void ) const
+{
+    return _is_float;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::int_w( void ) const
+{
+    return _int_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::exp_w( void ) const
+{
+    return _exp_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::frac_w( void ) const
+{
+    return _frac_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::guard_w( void ) const
+{
+    return _guard_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::w( void ) const
+{
+    return _w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::n( void ) const
+{
+    return _n;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::maxint( void ) const
+{
+    return _maxint;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::max( void ) const
+{
+    _log_1f( push_constant, to_flt(_max) );
+    return _max;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::min( void ) const
+{
+    _log_1f( push_constant, to_flt(_min) );
+    return _min;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::denorm_min( void ) const
+{
+    return min();
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::lowest( void ) const
+{
+    _log_1f( push_constant, to_flt(_lowest) );
+    return _lowest;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::epsilon( void ) const
+{
+    return min();
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::round_error( void ) const
+{
+    return min();
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::zero( void ) const
+{
+    _log_1f( push_constant, to_flt(_zero) );
+    return _zero;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::one( void ) const
+{
+    _log_1f( push_constant, to_flt(_one) ); 
+    return _one;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg_one( void ) const
+{
+    _log_1f( push_constant, to_flt(_neg_one) ); 
+    return _neg_one;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::two( void ) const
+{
+    _log_1f( push_constant, to_flt(_two) ); 
+    return _two;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::half( void ) const
+{
+    _log_1f( push_constant, to_flt(_half) ); 
+    return _half;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::quarter( void ) const
+{
+    _log_1f( push_constant, to_flt(_quarter) ); 
+    return _quarter;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt2( void ) const
+{
+    _log_1f( push_constant, to_flt(_sqrt2) ); 
+    return _sqrt2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt2_div_2( void ) const
+{
+    _log_1f( push_constant, to_flt(_sqrt2_div_2) ); 
+    return _sqrt2_div_2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi( void ) const
+{
+    _log_1f( push_constant, to_flt(_pi) ); 
+    return _pi;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tau( void ) const
+{
+    _log_1f( push_constant, to_flt(_tau) ); 
+    return _tau;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi_div_2( void ) const
+{
+    _log_1f( push_constant, to_flt(_pi_div_2) ); 
+    return _pi_div_2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi_div_4( void ) const
+{
+    _log_1f( push_constant, to_flt(_pi_div_4) ); 
+    return _pi_div_4;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::one_div_pi( void ) const
+{
+    _log_1f( push_constant, to_flt(_one_div_pi) ); 
+    return _one_div_pi;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::two_div_pi( void ) const
+{
+    _log_1f( push_constant, to_flt(_two_div_pi) ); 
+    return _two_div_pi;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::four_div_pi( void ) const
+{
+    _log_1f( push_constant, to_flt(_four_div_pi) ); 
+    return _four_div_pi;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::e( void ) const
 {
     _log_1f( push_constant, to_flt(_e) ); 
     return _e;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nan( const char * arg ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nan( const char * arg ) const
 {
     return to_t( FLT( std::strtod( arg, nullptr ) ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::quiet_NaN( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::quiet_NaN( void ) const
 {
     return to_t( std::numeric_limits<FLT>::quiet_NaN() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::signaling_NaN( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::signaling_NaN( void ) const
 {
     return to_t( std::numeric_limits<FLT>::signaling_NaN() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::infinity( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::infinity( void ) const
 {
     return to_t( std::numeric_limits<FLT>::infinity() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ninfinity( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ninfinity( void ) const
 {
     return to_t( -std::numeric_limits<FLT>::infinity() );
 }
@@ -1393,8 +2866,8 @@ inline T Cordic<T,FLT>::ninfinity( void ) const
 //-----------------------------------------------------
 // Conversion
 //-----------------------------------------------------
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::to_t( FLT _x, bool is_final, bool to_fixed ) const
 {
     if ( is_final && debug ) std::cout << "to_t begin: x=" << _x << " is_final=" << is_final << " to_fixed=" << to_fixed << "\n";
     FLT x = _x;
@@ -1499,14 +2972,14 @@ inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
     return x_t;
 }
 
-template< typename T, typename FLT >
-inline FLT Cordic<T,FLT>::to_flt( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline FLT Cordic<T,FLT,CORE>::to_flt( const T& x ) const
 {
     return _to_flt( x, true, false, true );
 }
 
-template< typename T, typename FLT >
-inline FLT Cordic<T,FLT>::_to_flt( const T& _x, bool is_final, bool from_fixed, bool allow_debug ) const
+template< typename T, typename FLT, typename CORE >
+inline FLT Cordic<T,FLT,CORE>::_to_flt( const T& _x, bool is_final, bool from_fixed, bool allow_debug ) const
 {
     T    x = _x;
     bool x_sign;
@@ -1555,15 +3028,15 @@ inline FLT Cordic<T,FLT>::_to_flt( const T& _x, bool is_final, bool from_fixed,
     return x_f;
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_string( const T& x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_string( const T& x, bool from_fixed ) const
 {
     // floating-point representation
     return std::to_string( _to_flt( x, false, from_fixed ) );  
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_rstring( const T& _x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_rstring( const T& _x, bool from_fixed ) const
 {
     // raw integer representation
     T x = _x;
@@ -1611,8 +3084,8 @@ inline std::string Cordic<T,FLT>::to_rstring( const T& _x, bool from_fixed ) con
     return s+i;
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_bstring( const T& _x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_bstring( const T& _x, bool from_fixed ) const
 {
     (void)from_fixed;
     // binary representation
@@ -1628,8 +3101,8 @@ inline std::string Cordic<T,FLT>::to_bstring( const T& _x, bool from_fixed ) con
     return bs;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::make_fixed( bool sign, const T& i, const T& f ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::make_fixed( bool sign, const T& i, const T& f ) const
 {
     cassert( !_is_float, "make_fixed may be called only for is_float=false Cordics" );
     cassert( i >= 0 && i <= _maxint, "make_fixed integer part must be in range 0 .. _maxint" );
@@ -1640,8 +3113,8 @@ inline T Cordic<T,FLT>::make_fixed( bool sign, const T& i, const T& f ) const
            (T(f)    << 0);
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::make_float( bool sign, const T& e, const T& f ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::make_float( bool sign, const T& e, const T& f ) const
 {
     cassert( _is_float, "make_float may be called only for is_float=true Cordics" );
     cassert( e >= 0 && e <= _exp_mask, "make_float biased exponent part must be in range 0 .. _exp_mask, got " + std::to_string(e) );
@@ -1655,9 +3128,15 @@ inline T Cordic<T,FLT>::make_float( bool sign, const T& e, const T& f ) const
 //-----------------------------------------------------
 // The CORDIC Functions
 //-----------------------------------------------------
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->circular_rotation_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -1  <= x0 <= 1
@@ -1673,6 +3152,11 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     cassert( z0 >= -ANGLE_MAX && z0 <= ANGLE_MAX, "circular_rotation |z0| must be <= circular_angle_max (" +
                                                   to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0, true) );
 
+    if ( _radix == 4 ) {
+        circular_rotation_radix4( x0, y0, z0, x, y, z );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (z >= 0) ? 1 : -1
     // xi = x - d*(y >> i)
@@ -1682,15 +3166,34 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
-    for( uint32_t i = 0; i <= n; i++ )
+    uint32_t n = iter_n( false );
+    uint32_t i_start = 0;
+    if ( _lut_prefix_w != 0 ) {
+        i_start = lut_prefix( true, x0, y0, z0, x, y, z );                      // replaces iterations 0 .. i_start-1
+    } else if ( _small_angle_skip && (i_start = small_angle_start( z0, ONE, n )) != 0 ) {
+        x = mul_fxd( x, _circular_skip_gain_fxd[i_start] );                     // skips iterations 0 .. i_start-1
+        y = mul_fxd( y, _circular_skip_gain_fxd[i_start] );
+        if ( logger_on() ) logger->iterations_skipped( this, i_start );
+    }
+    for( uint32_t i = i_start; i <= n; i++ )
     {
+        if ( _early_exit && z == 0 ) {
+            x = mul_fxd( x, _circular_tail_gain_fxd[i] );
+            y = mul_fxd( y, _circular_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
         T xi;
         T yi;
         T zi;
         if ( debug ) printf( "circular_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(z >= _zero_fxd) );
-        if ( z >= 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(z < 0);
+            xi = x - cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( _circular_atan_fxd[i], m );
+        } else if ( z >= 0 ) {
             xi = x - (y >> i);
             yi = y + (x >> i);
             zi = z - _circular_atan_fxd[i];
@@ -1703,6 +3206,14 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
         y = yi;
         z = zi;
     }
+    if ( _linear_finish ) {
+        // cos(z) = 1, sin(z) = z
+        const T xi = x - mul_fxd( y, z );
+        const T yi = y + mul_fxd( x, z );
+        x = xi;
+        y = yi;
+        z = 0;
+    }
 
     //-----------------------------------------------------
     // circular rotation mode results after step n:
@@ -1712,9 +3223,151 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation_batch( const T * x0, const T * y0, const T * z0, T * x, T * y, T * z, size_t cnt ) const
+{
+    const T ONE = _one_fxd;
+    const T ANGLE_MAX = _circular_angle_max_fxd + 2*_min_fxd;
+
+    //-----------------------------------------------------
+    // Work on blocks of LANES elements held in local arrays.
+    // Short blocks are padded with zeros so that the inner loop
+    // always has the same trip count.
+    //
+    // m = (z >= 0) ? 0 : -1
+    // cneg(v, m) = (v ^ m) - m = (z >= 0) ? v : -v
+    //
+    // That is the same d used by circular_rotation(), so results are bit-identical.
+    //-----------------------------------------------------
+    if ( !modes_are_default() ) {
+        // the lane loop below is classic radix-2 only
+        for( size_t k = 0; k < cnt; k++ ) circular_rotation( x0[k], y0[k], z0[k], x[k], y[k], z[k] );
+        return;
+    }
+
+    static constexpr size_t LANES = 16;
+    const uint32_t n = _n;
+    for( size_t b = 0; b < cnt; b += LANES )
+    {
+        const size_t lane_cnt = ((cnt - b) < LANES) ? (cnt - b) : LANES;
+        T xx[LANES];
+        T yy[LANES];
+        T zz[LANES];
+        for( size_t k = 0; k < LANES; k++ )
+        {
+            if ( k < lane_cnt ) {
+                cassert( x0[b+k] >= -ONE       && x0[b+k] <= ONE,       "circular_rotation_batch x0 must be in the range -1 .. 1" );
+                cassert( y0[b+k] >= -ONE       && y0[b+k] <= ONE,       "circular_rotation_batch y0 must be in the range -1 .. 1" );
+                cassert( z0[b+k] >= -ANGLE_MAX && z0[b+k] <= ANGLE_MAX, "circular_rotation_batch |z0| must be <= circular_angle_max (" +
+                                                                        to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0[b+k], true) );
+                xx[k] = x0[b+k];
+                yy[k] = y0[b+k];
+                zz[k] = z0[b+k];
+            } else {
+                xx[k] = 0;
+                yy[k] = 0;
+                zz[k] = 0;
+            }
+        }
+
+        for( uint32_t i = 0; i <= n; i++ )
+        {
+            const T a = _circular_atan_fxd[i];
+            for( size_t k = 0; k < LANES; k++ )
+            {
+                const T m  = -T(zz[k] < 0);
+                const T xi = xx[k] - cneg( yy[k] >> i, m );
+                const T yi = yy[k] + cneg( xx[k] >> i, m );
+                zz[k]     -= cneg( a, m );
+                xx[k]      = xi;
+                yy[k]      = yi;
+            }
+        }
+
+        for( size_t k = 0; k < lane_cnt; k++ )
+        {
+            if ( debug ) printf( "circular_rotation_batch: k=%zu xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", 
+                                 b+k, xx[k], yy[k], zz[k] );
+            x[b+k] = xx[k];
+            y[b+k] = yy[k];
+            z[b+k] = zz[k];
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+uint64_t Cordic<T,FLT,CORE>::circular_rotation_dirs( const T& z0 ) const
+{
+    const T ANGLE_MAX = _circular_angle_max_fxd + 2*_min_fxd;
+    cassert( _n < 64, "circular_rotation_dirs requires n < 64" );
+    cassert( z0 >= -ANGLE_MAX && z0 <= ANGLE_MAX, "circular_rotation_dirs |z0| must be <= circular_angle_max (" +
+                                                  to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0, true) );
+
+    //-----------------------------------------------------
+    // Early steps subtract atan(2^-i) from z like circular_rotation().
+    // Once atan(2^-i) == 2^-i exactly (i >= _circular_dirs_recode_i), the rest 
+    // is non-restoring binary recoding.  With weights 2^k for k=K..0,
+    // d_k = (z >= 0) picks exactly the bits of (z + 2^(K+1)-1 + 1) >> 1,
+    // clamped to K+1 bits.
+    //-----------------------------------------------------
+    uint64_t dirs = 0;
+    T z = z0;
+    const uint32_t n = _n;
+    const uint32_t m = _circular_dirs_recode_i;
+    for( uint32_t i = 0; i < m && i <= n; i++ )
+    {
+        if ( z >= 0 ) {
+            dirs |= uint64_t(1) << i;
+            z -= _circular_atan_fxd[i];
+        } else {
+            z += _circular_atan_fxd[i];
+        }
+    }
+    if ( m <= n ) {
+        const uint32_t cnt  = n - m + 1;                                // K+1
+        const T        zk   = z >> (_frac_guard_w - n);                 // weights are now 2^(n-i)
+        const T        all  = (T(1) << cnt) - 1;
+        T              bits = (zk + all + 1) >> 1;
+        if ( bits < 0   ) bits = 0;
+        if ( bits > all ) bits = all;
+        for( uint32_t i = m; i <= n; i++ )
+        {
+            if ( (bits >> (n - i)) & 1 ) dirs |= uint64_t(1) << i;
+        }
+    }
+    if ( debug ) printf( "circular_rotation_dirs: z0=%.30f dirs=0x%016" FMT_LLX "\n", _to_flt(z0, false, true), dirs );
+    return dirs;
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation_xy( const T& x0, const T& y0, uint64_t dirs, T& x, T& y ) const
+{
+    const T ONE = _one_fxd;
+    cassert( x0 >= -ONE && x0 <= ONE, "circular_rotation_xy x0 must be in the range -1 .. 1" );
+    cassert( y0 >= -ONE && y0 <= ONE, "circular_rotation_xy y0 must be in the range -1 .. 1" );
+
+    x = x0;
+    y = y0;
+    const uint32_t n = _n;
+    for( uint32_t i = 0; i <= n; i++ )
+    {
+        const T m  = T((dirs >> i) & 1) - 1;                            // 0 or -1
+        const T xi = x - cneg( y >> i, m );
+        const T yi = y + cneg( x >> i, m );
+        x = xi;
+        y = yi;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->circular_vectoring_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -3  <= x0 <= 3
@@ -1734,6 +3387,11 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
     cassert( std::abs( std::atan( _to_flt(y0, false, true) / _to_flt(x0, false, true) ) ) <= _to_flt(ANGLE_MAX, false, true),
                                         "circular_vectoring |atan(y0/x0)| must be <= circular_angle_max" );
 
+    if ( _radix == 4 ) {
+        circular_vectoring_radix4( x0, y0, z0, x, y, z, true );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (y < 0) ? 1 : -1
     // xi = x - d*(y >> i)
@@ -1743,15 +3401,28 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
-    for( uint32_t i = 0; i <= n; i++ )
+    uint32_t n = iter_n( false );
+    uint32_t i_start = 0;
+    if ( _small_angle_skip && x0 > 0 ) i_start = small_angle_start( y0, x0, n );  // skips iterations 0 .. i_start-1
+    if ( i_start != 0 && logger_on() ) logger->iterations_skipped( this, i_start );
+    for( uint32_t i = i_start; i <= n; i++ )
     {
+        if ( _early_exit && y == 0 ) {
+            x = mul_fxd( x, _circular_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
         T xi;
         T yi;
         T zi;
         if ( debug ) printf( "circular_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int((x < 0) != (y < 0)) );
-        if ( y < 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(y >= 0);
+            xi = x - cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( _circular_atan_fxd[i], m );
+        } else if ( y < 0 ) {
             xi = x - (y >> i);
             yi = y + (x >> i);
             zi = z - _circular_atan_fxd[i];
@@ -1764,6 +3435,12 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
         y = yi;
         z = zi;
     }
+    if ( _linear_finish && x != 0 ) {
+        // atan(y/x) = y/x, sqrt(x^2 + y^2) = x
+        z += div_fxd( y, x );
+        y = 0;
+    }
+    if ( i_start != 0 ) x = mul_fxd( x, _circular_skip_gain_fxd[i_start] );   // y is 0, so only x needs the skipped gain
 
     //-----------------------------------------------------
     // circular vectoring mode results after step n:
@@ -1773,9 +3450,15 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->circular_vectoring_xy_unrolled( x0, y0, x, y );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -3  <= x0 <= 3
@@ -1788,6 +3471,12 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
     cassert( x0 >= -THREE && x0 <= THREE, "circular_vectoring_xy x0 must be in the range -3 .. 3" );
     cassert( y0 >= -ONE   && y0 <= ONE  , "circular_vectoring_xy y0 must be in the range -1 .. 1" );
 
+    if ( _radix == 4 ) {
+        T z;
+        circular_vectoring_radix4( x0, y0, _zero_fxd, x, y, z, false );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (y < 0) ? 1 : -1
     // xi = x - d*(y >> i)
@@ -1795,14 +3484,23 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
     //-----------------------------------------------------
     x = x0;
     y = y0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( false );
     for( uint32_t i = 0; i <= n; i++ )
     {
+        if ( _early_exit && y == 0 ) {
+            x = mul_fxd( x, _circular_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
         T xi;
         T yi;
         if ( debug ) printf( "circular_vectoring_xy: i=%d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f] test=%d\n", 
                              i, x, y, _to_flt(x, false, true), _to_flt(y, false, true), int(y < 0) );
-        if ( y < 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(y >= 0);
+            xi = x - cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+        } else if ( y < 0 ) {
             xi = x - (y >> i);
             yi = y + (x >> i);
         } else {
@@ -1812,6 +3510,7 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
         x = xi;
         y = yi;
     }
+    if ( _linear_finish ) y = 0;                                              // sqrt(x^2 + y^2) = x
 
     //-----------------------------------------------------
     // circular vectoring mode results after step n:
@@ -1820,23 +3519,36 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, const T * atanh_tbl ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled && atanh_tbl == nullptr ) {
+            static_cast<const CORE *>( this )->hyperbolic_rotation_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -1  <= x0 <= 1
     //      -1  <= y0 <= 1
-    //      |z0| <= 1.1182...
+    //      |z0| <= 1.1182...  (more with hyperbolic_neg_iter_set())
     //-----------------------------------------------------
     const T TWO = _two_fxd;
-    const T ANGLE_MAX = _hyperbolic_angle_max_fxd + 2*_min_fxd;
+    const T ANGLE_MAX = ((_hyperbolic_neg_iter_cnt != 0) ? _hyperbolic_neg_angle_max_fxd : _hyperbolic_angle_max_fxd) + 2*_min_fxd;
     if ( debug ) printf( "hyperbolic_rotation begin: xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f]\n",
                          x0, y0, z0, _to_flt(x0, false, true), _to_flt(y0, false, true), _to_flt(z0, false, true) );
     cassert( x0 >= -TWO       && x0 <= TWO,       "hyperbolic_rotation x0 must be in the range -2 .. 2" );
     cassert( y0 >= -TWO       && y0 <= TWO,       "hyperbolic_rotation y0 must be in the range -2 .. 2" );
     cassert( z0 >= -ANGLE_MAX && z0 <= ANGLE_MAX, "hyperbolic_rotation |z0| must be <= hyperbolic_angle_max (" + 
                                                   to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0, true) );
+    cassert( atanh_tbl == nullptr || base_scaled_ok( 2 ), "hyperbolic_rotation atanh_tbl requires the plain radix-2 loop" );
+    const T * atanh = (atanh_tbl != nullptr) ? atanh_tbl : _hyperbolic_atanh_fxd;
+
+    if ( _radix == 4 && z0 >= -_hyperbolic_radix4_angle_max_fxd && z0 <= _hyperbolic_radix4_angle_max_fxd ) {
+        hyperbolic_rotation_radix4( x0, y0, z0, x, y, z );
+        return;
+    }
 
     //-----------------------------------------------------
     // d = (z >= 0) ? 1 : -1
@@ -1847,23 +3559,86 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( false );
     uint32_t next_dup_i = 4;     
-    for( uint32_t i = 1; i <= n; i++ )
+    uint32_t i_start = 1;
+    if ( _hyperbolic_neg_iter_cnt != 0 && (z0 < -_hyperbolic_angle_max_fxd || z0 > _hyperbolic_angle_max_fxd) ) {
+        //-----------------------------------------------------
+        // negative iterations i = 1-k .. 0, only when z0 needs them:
+        // xi = x + d*(y - (y >> (2-i)))
+        // yi = y + d*(x - (x >> (2-i)))
+        // zi = z - d*arctanh(1 - 2^(i-2))
+        //-----------------------------------------------------
+        x = mul_fxd( x, _hyperbolic_neg_one_over_gain_fxd );
+        y = mul_fxd( y, _hyperbolic_neg_one_over_gain_fxd );
+        for( uint32_t j = 0; j < _hyperbolic_neg_iter_cnt; j++ )
+        {
+            const uint32_t s  = _hyperbolic_neg_iter_cnt + 1 - j;          // 2-i
+            const T        xs = x - (x >> s);
+            const T        ys = y - (y >> s);
+            T xi;
+            T yi;
+            T zi;
+            if constexpr ( branchless ) {
+                const T m = -T(z < 0);
+                xi = x + cneg( ys, m );
+                yi = y + cneg( xs, m );
+                zi = z - cneg( _hyperbolic_neg_atanh_fxd[j], m );
+            } else if ( z >= 0 ) {
+                xi = x + ys;
+                yi = y + xs;
+                zi = z - _hyperbolic_neg_atanh_fxd[j];
+            } else {
+                xi = x - ys;
+                yi = y - xs;
+                zi = z + _hyperbolic_neg_atanh_fxd[j];
+            }
+            x = xi;
+            y = yi;
+            z = zi;
+        }
+    }
+    if ( _lut_prefix_w != 0 ) {
+        i_start = lut_prefix( false, x0, y0, z0, x, y, z );                     // replaces iterations 1 .. i_start-1
+        while( next_dup_i < i_start ) next_dup_i = 3*next_dup_i + 1;
+    } else if ( _small_angle_skip ) {
+        const uint32_t s = small_angle_start( z0, _one_fxd, n );
+        if ( s != 0 ) {
+            i_start = s;                                                        // skips iterations 1 .. i_start-1
+            x = mul_fxd( x, _hyperbolic_skip_gain_fxd[s] );
+            y = mul_fxd( y, _hyperbolic_skip_gain_fxd[s] );
+            while( next_dup_i < i_start ) next_dup_i = 3*next_dup_i + 1;
+            if ( logger_on() ) logger->iterations_skipped( this, i_start - 1 );
+        }
+    }
+    bool redo = false;                                                          // second pass of a repeated iteration
+    for( uint32_t i = i_start; i <= n; i++ )
     {
+        if ( _early_exit && z == 0 && !redo ) {
+            x = mul_fxd( x, _hyperbolic_tail_gain_fxd[i] );
+            y = mul_fxd( y, _hyperbolic_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
+        redo = false;
         T xi;
         T yi;
         T zi;
         if ( debug ) printf( "hyperbolic_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(z >= 0) );
-        if ( z >= 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(z < 0);
+            xi = x + cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( atanh[i], m );
+        } else if ( z >= 0 ) {
             xi = x + (y >> i);
             yi = y + (x >> i);
-            zi = z - _hyperbolic_atanh_fxd[i];
+            zi = z - atanh[i];
         } else {
             xi = x - (y >> i);
             yi = y - (x >> i);
-            zi = z + _hyperbolic_atanh_fxd[i];
+            zi = z + atanh[i];
         }
         x = xi;
         y = yi;
@@ -1873,8 +3648,17 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
             // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
             next_dup_i = 3*i + 1;
             i--;
+            redo = true;
         }
     }
+    if ( _linear_finish ) {
+        // cosh(z) = 1, sinh(z) = z
+        const T xi = x + mul_fxd( y, z );
+        const T yi = y + mul_fxd( x, z );
+        x = xi;
+        y = yi;
+        z = 0;
+    }
 
     //-----------------------------------------------------
     // hyperbolic rotation mode results after step n:
@@ -1884,9 +3668,15 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, const T * atanh_tbl ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled && atanh_tbl == nullptr ) {
+            static_cast<const CORE *>( this )->hyperbolic_vectoring_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -2  <= x0 <= 2
@@ -1905,6 +3695,13 @@ void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0,
     cassert( (ANGLE_MAX == 0 || std::abs( std::atanh( _to_flt(y0, false, true) / _to_flt(x0, false, true) ) ) <= _to_flt(ANGLE_MAX, false, true)),
                                         "hyperbolic_vectoring |atanh(y0/x0)| must be <= hyperbolic_angle_max=" + 
                                         std::to_string(_to_flt(ANGLE_MAX, false, true)) );
+    cassert( atanh_tbl == nullptr || base_scaled_ok( 2 ), "hyperbolic_vectoring atanh_tbl requires the plain radix-2 loop" );
+    const T * atanh = (atanh_tbl != nullptr) ? atanh_tbl : _hyperbolic_atanh_fxd;
+
+    if ( _radix == 4 && hyperbolic_radix4_vectoring_ok( x0, y0 ) ) {
+        hyperbolic_vectoring_radix4( x0, y0, z0, x, y, z, true );
+        return;
+    }
 
     //-----------------------------------------------------
     // d = (y < 0) ? 1 : -1
@@ -1915,23 +3712,44 @@ void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0,
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( false );
     uint32_t next_dup_i = 4;     
-    for( uint32_t i = 1; i <= n; i++ )
+    uint32_t i_start = 1;
+    if ( _small_angle_skip && x0 > 0 ) {
+        const uint32_t s = small_angle_start( y0, x0, n );
+        if ( s != 0 ) {
+            i_start = s;                                                        // skips iterations 1 .. i_start-1
+            while( next_dup_i < i_start ) next_dup_i = 3*next_dup_i + 1;
+            if ( logger_on() ) logger->iterations_skipped( this, i_start - 1 );
+        }
+    }
+    bool redo = false;                                                          // second pass of a repeated iteration
+    for( uint32_t i = i_start; i <= n; i++ )
     {
+        if ( _early_exit && y == 0 && !redo ) {
+            x = mul_fxd( x, _hyperbolic_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
+        redo = false;
         T xi;
         T yi;
         T zi;
         if ( debug ) printf( "hyperbolic_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int((x < 0) != (y < 0)) );
-        if ( y < 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(y >= 0);
+            xi = x + cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( atanh[i], m );
+        } else if ( y < 0 ) {
             xi = x + (y >> i);
             yi = y + (x >> i);
-            zi = z - _hyperbolic_atanh_fxd[i];
+            zi = z - atanh[i];
         } else {
             xi = x - (y >> i);
             yi = y - (x >> i);
-            zi = z + _hyperbolic_atanh_fxd[i];
+            zi = z + atanh[i];
         }
         x = xi;
         y = yi;
@@ -1941,8 +3759,15 @@ void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0,
             // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
             next_dup_i = 3*i + 1;
             i--;
+            redo = true;
         }
     }
+    if ( _linear_finish && x != 0 ) {
+        // atanh(y/x) = y/x, sqrt(x^2 - y^2) = x
+        z += div_fxd( y, x );
+        y = 0;
+    }
+    if ( i_start != 1 ) x = mul_fxd( x, _hyperbolic_skip_gain_fxd[i_start] );  // y is 0, so only x needs the skipped gain
 
     //-----------------------------------------------------
     // hyperbolic vectoring mode results after step n:
@@ -1952,9 +3777,15 @@ void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0,
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->hyperbolic_vectoring_xy_unrolled( x0, y0, x, y );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -2  <= x0 <= 2
@@ -1967,6 +3798,12 @@ void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T&
     cassert( x0 >= -TWO && x0 <= TWO, "hyperbolic_vectoring_xy x0 must be in the range -2 .. 2" );
     cassert( y0 >= -TWO && y0 <= TWO, "hyperbolic_vectoring_xy y0 must be in the range -2 .. 2" );
 
+    if ( _radix == 4 && hyperbolic_radix4_vectoring_ok( x0, y0 ) ) {
+        T z;
+        hyperbolic_vectoring_radix4( x0, y0, _zero_fxd, x, y, z, false );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (y < 0) ? 1 : -1
     // xi = x - d*(y >> i)
@@ -1974,15 +3811,26 @@ void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T&
     //-----------------------------------------------------
     x = x0;
     y = y0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( false );
     uint32_t next_dup_i = 4;     
+    bool redo = false;                                                          // second pass of a repeated iteration
     for( uint32_t i = 1; i <= n; i++ )
     {
+        if ( _early_exit && y == 0 && !redo ) {
+            x = mul_fxd( x, _hyperbolic_tail_gain_fxd[i] );
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
+        redo = false;
         T xi;
         T yi;
         if ( debug ) printf( "hyperbolic_vectoring_xy: i=%2d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f] test=%d\n", 
                              i, x, y, _to_flt(x, false, true), _to_flt(y, false, true), int(y < 0) );
-        if ( y < 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(y >= 0);
+            xi = x + cneg( y >> i, m );
+            yi = y + cneg( x >> i, m );
+        } else if ( y < 0 ) {
             xi = x + (y >> i);
             yi = y + (x >> i);
         } else {
@@ -1996,8 +3844,10 @@ void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T&
             // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
             next_dup_i = 3*i + 1;
             i--;
+            redo = true;
         }
     }
+    if ( _linear_finish ) y = 0;                                              // sqrt(x^2 - y^2) = x
 
     //-----------------------------------------------------
     // hyperbolic vectoring mode results after step n:
@@ -2006,9 +3856,27 @@ void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T&
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::base_scaled_ok( FLT b ) const
+{
+    return (b == FLT(2) || b == FLT(10)) && _radix == 2 && _lut_prefix_w == 0 && !_linear_finish && !_small_angle_skip;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline const T * Cordic<T,FLT,CORE>::base_scaled_atanh( FLT b ) const
+{
+    return (b == FLT(2)) ? _base2_atanh_fxd : _base10_atanh_fxd;
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->linear_rotation_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -2    <= x0 <= 2
@@ -2023,6 +3891,11 @@ void Cordic<T,FLT>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x
     cassert( y0 >= -TWO && y0 <= TWO, "linear_rotation y0 must be in the range -2 .. 2" );
     //cassert( z0 >= -ONE && z0 <= ONE, "linear_rotation z0 must be in the range -1 .. 1" );
     
+    if ( _radix == 4 ) {
+        linear_rotation_radix4( x0, y0, z0, x, y, z );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (z >= 0) ? 1 : -1
     // xi = x 
@@ -2032,15 +3905,23 @@ void Cordic<T,FLT>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( true );
     T pow2 = ONE;
     for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
     {
+        if ( _early_exit && z == 0 ) {
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
         if ( debug ) printf( "linear_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(z >= 0) );
         T yi;
         T zi;
-        if ( z >= 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(z < 0);
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( pow2, m );
+        } else if ( z >= 0 ) {
             yi = y + (x >> i);
             zi = z - pow2;
         } else {
@@ -2059,9 +3940,15 @@ void Cordic<T,FLT>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
+    if constexpr ( !std::is_void<CORE>::value ) {
+        if ( _unrolled ) {
+            static_cast<const CORE *>( this )->linear_vectoring_unrolled( x0, y0, z0, x, y, z );
+            return;
+        }
+    }
     //-----------------------------------------------------
     // input ranges allowed:
     //      -2      <= x0 <= 2
@@ -2077,6 +3964,11 @@ void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T&
     //cassert( std::abs( _to_flt(y0, false, true) / _to_flt(x0, false, true) ) <= FLT(1.0) &&
     //                                    "linear_vectoring y0/x0 must be in the range -1 .. 1" );
     
+    if ( _radix == 4 ) {
+        linear_vectoring_radix4( x0, y0, z0, x, y, z );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (y < 0) ? 1 : -1
     // xi = x
@@ -2086,15 +3978,23 @@ void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T&
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    uint32_t n = iter_n( true );
     T pow2 = ONE;
     for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
     {
+        if ( _early_exit && y == 0 ) {
+            if ( logger_on() ) logger->iterations_skipped( this, n - i + 1 );
+            break;
+        }
         if ( debug ) printf( "linear_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
                              i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(y < 0) );
         T yi;
         T zi;
-        if ( y < 0 ) {
+        if constexpr ( branchless ) {
+            const T m = -T(y >= 0);
+            yi = y + cneg( x >> i, m );
+            zi = z - cneg( pow2, m );
+        } else if ( y < 0 ) {
             yi = y + (x >> i);
             zi = z - pow2;
         } else {
@@ -2113,49 +4013,549 @@ void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T&
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::constructed( const T& x ) const
+//-----------------------------------------------------
+// Radix-4 Versions
+//
+// Step j uses digit d in {-2,-1,0,1,2} and shifts by 2j (|d|=1) or 2j-1 (|d|=2).
+// Digits are picked by comparing the residual against the midpoints between 
+// the angles (rotation) or between the multiples of x (vectoring).
+// Circular j=0 is limited to |d| <= 1 because |z0| <= PI/4.
+// Hyperbolic starts at j=1 and needs no repeated steps.
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cneg( const T& v, const T& m )
+{
+    return (v ^ m) - m;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul_fxd( const T& x, const T& y ) const
+{
+    return T( (T2( x ) * T2( y )) >> _frac_guard_w );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div_fxd( const T& x, const T& y ) const
+{
+    return T( (T2( x ) << _frac_guard_w) / T2( y ) );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul_fxd_sticky( const T& x, const T& y ) const
+{
+    const T2 p = T2( x ) * T2( y );
+    return T( p >> _frac_guard_w ) | T( (p & ((T2( 1 ) << _frac_guard_w) - 1)) != 0 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div_fxd_sticky( const T& x, const T& y ) const
+{
+    const T2 n = T2( x ) << _frac_guard_w;
+    return T( n / T2( y ) ) | T( (n % T2( y )) != 0 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div_fix_up( const T& y, const T& x, T q ) const
+{
+    T2 r = (T2( y ) << _frac_guard_w) - T2( q ) * T2( x );
+    while( r < 0 )         { q--; r += x; }
+    while( r >= T2( x ) )  { q++; r -= x; }
+    return q | T( r != 0 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt_fix_up( const T& a, T q ) const
+{
+    T2 r = (T2( a ) << _frac_guard_w) - T2( q ) * T2( q );
+    while( r < 0 )                 { r += 2*T2( q ) - 1; q--; }
+    while( r > 2*T2( q ) )         { r -= 2*T2( q ) + 1; q++; }
+    return q | T( r != 0 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::seed( const T * seeds, const T& x, uint32_t int_w ) const
+{
+    const int32_t s = int32_t(_frac_guard_w + int_w) - 8;
+    return seeds[((s >= 0) ? (x >> s) : (x << -s)) & 0xff];
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::normalize( T& m, int32_t& e ) const
+{
+    const int32_t ls = int32_t(_frac_guard_w) - msb( m );
+    if ( ls > 0 ) {
+        m <<= ls;
+        e  -= ls;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline int32_t Cordic<T,FLT,CORE>::srt4_digit( const int8_t * m, int32_t est )
+{
+    // m[] holds the -1, 0, 1, 2 thresholds in units of 1/16
+    return (est >= m[3]) ? 2 : (est >= m[2]) ? 1 : (est >= m[1]) ? 0 : (est >= m[0]) ? -1 : -2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::srt4_append( T& q, T& qm, int32_t s )
+{
+    // on-the-fly conversion: q = 4q+s and qm = q-1 without a borrow from the digits above
+    const T qn = (s >= 0) ? 4*q  + s       : 4*qm + (4 + s);
+    qm         = (s >  0) ? 4*q  + (s - 1) : 4*qm + (3 + s);
+    q          = qn;
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::div_engine_div( const T& y, const T& x ) const
+{
+    switch( _div_engine )
+    {
+        case DIV_ENGINE::SRT4:
+        {
+            //-----------------------------------------------------
+            // Radix-4 SRT with digits {-2..2} on w0/d where d = x/2 in [1/2,1) and w0 = y/8,
+            // so y/x = 4*w0/d and |w| <= 2d/3 throughout.  w is in units of 2^-(fgw+3).
+            // Each digit is selected from 4w truncated to 1/16 (two's complement, so the
+            // estimate is never above 4w) against the P-D plot thresholds for the
+            // 1/16-wide interval that holds d, i.e., 3 bits of x after the leading 1.
+            // q and qm = q-1 are formed on the fly, so a negative digit never borrows and
+            // the final correction for a negative w just picks qm.
+            //-----------------------------------------------------
+            static constexpr int8_t sel[8][4] = {
+                { -13,  -5,  3, 12 }, { -15,  -6,  4, 14 }, { -16,  -6,  4, 15 }, { -18,  -7,  4, 16 },
+                { -20,  -8,  5, 18 }, { -21,  -8,  5, 19 }, { -23,  -9,  5, 20 }, { -25, -10,  6, 22 } };
+            const uint32_t m   = (_frac_guard_w + 5) / 2;      // 2m >= frac_guard_w + 4
+            const T2       d   = T2( x ) << 2;
+            const int8_t * row = sel[(x >> (_frac_guard_w - 3)) & 7];
+            T2 w  = y;
+            T  q  = 0;
+            T  qm = -1;
+            for( uint32_t j = 0; j < m; j++ )
+            {
+                w <<= 2;
+                const int32_t s = srt4_digit( row, int32_t( w >> (_frac_guard_w - 1) ) );
+                w -= s * d;
+                srt4_append( q, qm, s );
+            }
+            if ( w < 0 ) {
+                w += d;
+                q  = qm;
+            }
+            return rshift_sticky( q, 2*m - 2 - _frac_guard_w ) | T( w != 0 );
+        }
+
+        case DIV_ENGINE::NEWTON:
+        {
+            // r = r*(2 - x*r)
+            T r = seed( _rcp_seed_fxd, x, 0 );
+            for( uint32_t i = 0; i < _rcp_iter_cnt; i++ )
+            {
+                r = mul_fxd( r, (_one_fxd << 1) - mul_fxd( x, r ) );
+            }
+            return div_fix_up( y, x, mul_fxd( y, r ) );
+        }
+
+        case DIV_ENGINE::GOLDSCHMIDT:
+        {
+            // n/d with both multiplied by f = 2 - d until d == 1
+            const T f0 = seed( _rcp_seed_fxd, x, 0 );
+            T n = mul_fxd( y, f0 );
+            T d = mul_fxd( x, f0 );
+            for( uint32_t i = 0; i < _rcp_iter_cnt; i++ )
+            {
+                const T f = (_one_fxd << 1) - d;
+                n = mul_fxd( n, f );
+                d = mul_fxd( d, f );
+            }
+            return div_fix_up( y, x, n );
+        }
+
+        default:
+        {
+            T xx, yy, rr;
+            linear_vectoring( x, y, _zero, xx, yy, rr );
+            return rr;
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::div_engine_sqrt( const T& a ) const
+{
+    switch( _div_engine )
+    {
+        case DIV_ENGINE::SRT4:
+        {
+            //-----------------------------------------------------
+            // Radix-4 SRT square root with digits {-2..2} on x = a/4 in [1/4,1),
+            // starting from S = 1 and w = x - 1.  With t = 4^-(j+1):
+            //
+            //      w = 4w - s*(2S + s*t)       S = S + s*t
+            //
+            // where w is scaled by 4^j and kept in p fraction bits.  The digit is selected
+            // from 4w truncated to 1/16 against thresholds for the 1/16-wide interval that
+            // holds S.  The first two steps see a coarse S and a large s*t, so they
+            // have their own rows (j=0: S=1; j=1: S=1/2, 3/4, 1).  S and sm = S-t are
+            // formed on the fly, and 2S + s*t is just 8S+s or 8sm+8+s in units of t.
+            //-----------------------------------------------------
+            static constexpr int8_t sel[14][4] = {
+                { -22,  -9,  6, 22 }, { -25, -10,  7, 25 }, { -29, -11,  7, 28 }, { -32, -13,  8, 30 },
+                { -35, -14,  9, 33 }, { -39, -15,  9, 36 }, { -42, -17, 10, 38 }, { -45, -18, 11, 41 },
+                { -49, -19, 11, 44 }, { -52, -21, 12, 46 },                                             // 16*S = 7 .. 16
+                { -42, -19, 12, 50 },                                                                   // j=0
+                { -23, -10,  6, 24 }, { -37, -15,  9, 34 }, { -50, -20, 11, 45 } };                     // j=1
+            const uint32_t m  = (_frac_guard_w + 2) / 2;       // 2m >= frac_guard_w + 1
+            const uint32_t p  = 2*m + 2;
+            T2 w  = (T2( a ) << (p - _frac_guard_w - 2)) - (T2( 1 ) << p);
+            T  r  = 1;
+            T  rm = 0;
+            for( uint32_t j = 0; j < m; j++ )
+            {
+                w <<= 2;
+                const uint32_t i = (j == 0) ? 10 : (j == 1) ? 9 + uint32_t( r ) : uint32_t( r >> (2*j - 4) ) - 7;
+                const int32_t  s = srt4_digit( sel[i], int32_t( w >> (p - 4) ) );
+                if ( s > 0 ) {
+                    w -= (T2( s ) * (8*T2( r ) + s)) << (p - 2*j - 2);
+                } else if ( s < 0 ) {
+                    w += (T2( -s ) * (8*T2( rm ) + 8 + s)) << (p - 2*j - 2);
+                }
+                srt4_append( r, rm, s );
+            }
+            if ( w < 0 ) r = rm;
+            return rshift_sticky( r, 2*m - 1 - _frac_guard_w ) | T( w != 0 );
+        }
+
+        case DIV_ENGINE::NEWTON:
+        case DIV_ENGINE::GOLDSCHMIDT:
+            return sqrt_fix_up( a, mul_fxd( a, rsqrt_kernel( a ) ) );
+
+        default:
+            cassert( false, "div_engine_sqrt() should not be used for the CORDIC engine" );
+            return a;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rsqrt_kernel( const T& a ) const
+{
+    T r = seed( _rsqrt_seed_fxd, a, 2 );
+    if ( _div_engine != DIV_ENGINE::GOLDSCHMIDT ) {
+        // r = r*(3 - a*r^2)/2
+        for( uint32_t i = 0; i < _rsqrt_iter_cnt; i++ )
+        {
+            r = mul_fxd( r, 3*_one_fxd - mul_fxd( a, mul_fxd( r, r ) ) ) >> 1;
+        }
+    } else {
+        // g -> sqrt(a), h -> 1/(2*sqrt(a))
+        T g = mul_fxd( a, r );
+        T h = r >> 1;
+        for( uint32_t i = 0; i < _rsqrt_iter_cnt; i++ )
+        {
+            const T e = (_one_fxd >> 1) - mul_fxd( g, h );
+            g += mul_fxd( g, e );
+            h += mul_fxd( h, e );
+        }
+        r = h << 1;
+    }
+    return r;
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rcbrt_kernel( const T& a ) const
 {
-    if ( logger != nullptr ) logger->constructed( &x, this );
+    // r = r*(4 - a*r^3)/3
+    T r = seed( _rcbrt_seed_fxd, a, 3 );
+    for( uint32_t i = 0; i < _rcbrt_iter_cnt; i++ )
+    {
+        r = mul_fxd( mul_fxd( r, 4*_one_fxd - mul_fxd( a, mul_fxd( r, mul_fxd( r, r ) ) ) ), _third_fxd );
+    }
+    return r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::circular_radix4_atan( uint32_t i ) const
+{
+    return (i <= _n) ? _circular_atan_fxd[i] : (_one_fxd >> i);          // atan(x) == x for tiny x
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hyperbolic_radix4_atanh( uint32_t i ) const
+{
+    return (i <= _n) ? _hyperbolic_atanh_fxd[i] : (_one_fxd >> i);       // atanh(x) == x for tiny x
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::radix4_rotation_digit( const T& az, const T& a1, const T& a2, bool allow_2 ) const
+{
+    // a1 = angle for |d|=1, a2 = angle for |d|=2
+    return (az < (a1 >> 1)) ? 0 : (!allow_2 || az < ((a1 + a2) >> 1)) ? 1 : 2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::radix4_vectoring_digit( const T& ay, const T& ax, uint32_t j, bool allow_2 ) const
+{
+    // |y| vs. 0.5*4^-j*|x| and 1.5*4^-j*|x|
+    const T t1 = ax >> (2*j + 1);
+    const T t2 = t1 + (ax >> (2*j));
+    return (ay < t1) ? 0 : (!allow_2 || ay < t2) ? 1 : 2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::hyperbolic_radix4_vectoring_ok( const T& x0, const T& y0 ) const
+{
+    // |y0/x0| <= 0.6, i.e., |atanh(y0/x0)| <= 0.69
+    const T ax = (x0 < 0) ? -x0 : x0;
+    const T ay = (y0 < 0) ? -y0 : y0;
+    return (ay + (ay >> 2)) <= ((ax >> 1) + (ax >> 2));
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    T c = _circular_rotation_gain_fxd;  // radix-2 gain divided by the radix-4 scale factor
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 0; j <= m; j++ )
+    {
+        const T        a1 = circular_radix4_atan( 2*j );
+        const T        a2 = (j == 0) ? a1 : circular_radix4_atan( 2*j-1 );
+        const uint32_t d  = radix4_rotation_digit( (z < 0) ? -z : z, a1, a2, j != 0 );
+        if ( debug ) printf( "circular_rotation_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (z < 0) ? -int(d) : int(d) );
+        if ( d == 0 ) continue;
+
+        const uint32_t sh = 2*j + 1 - d;
+        const T        a  = (d == 1) ? a1 : a2;
+        T xi;
+        T yi;
+        if ( z >= 0 ) {
+            xi = x - (y >> sh);
+            yi = y + (x >> sh);
+            z  = z - a;
+        } else {
+            xi = x + (y >> sh);
+            yi = y - (x >> sh);
+            z  = z + a;
+        }
+        x = xi;
+        y = yi;
+        const T f = _circular_radix4_scale_fxd[2*j+d-1];
+        if ( f != _one_fxd ) c = mul_fxd( c, f );
+    }
+    x = mul_fxd( x, c );
+    y = mul_fxd( y, c );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, bool need_z ) const
+{
+    T c = _circular_vectoring_gain_fxd;  // radix-2 gain divided by the radix-4 scale factor
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 0; j <= m; j++ )
+    {
+        const uint32_t d  = radix4_vectoring_digit( (y < 0) ? -y : y, (x < 0) ? -x : x, j, j != 0 );
+        if ( debug ) printf( "circular_vectoring_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (y < 0) ? int(d) : -int(d) );
+        if ( d == 0 ) continue;
+
+        const uint32_t sh = 2*j + 1 - d;
+        const T        a  = need_z ? circular_radix4_atan( sh ) : T(0);
+        T xi;
+        T yi;
+        if ( y < 0 ) {
+            xi = x - (y >> sh);
+            yi = y + (x >> sh);
+            z  = z - a;
+        } else {
+            xi = x + (y >> sh);
+            yi = y - (x >> sh);
+            z  = z + a;
+        }
+        x = xi;
+        y = yi;
+        const T f = _circular_radix4_scale_fxd[2*j+d-1];
+        if ( f != _one_fxd ) c = mul_fxd( c, f );
+    }
+    x = mul_fxd( x, c );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    T c = _hyperbolic_rotation_gain_fxd;  // radix-2 gain divided by the radix-4 scale factor
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 1; j <= m; j++ )
+    {
+        const T        a1 = hyperbolic_radix4_atanh( 2*j );
+        const T        a2 = hyperbolic_radix4_atanh( 2*j-1 );
+        const uint32_t d  = radix4_rotation_digit( (z < 0) ? -z : z, a1, a2, true );
+        if ( debug ) printf( "hyperbolic_rotation_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (z < 0) ? -int(d) : int(d) );
+        if ( d == 0 ) continue;
+
+        const uint32_t sh = 2*j + 1 - d;
+        const T        a  = (d == 1) ? a1 : a2;
+        T xi;
+        T yi;
+        if ( z >= 0 ) {
+            xi = x + (y >> sh);
+            yi = y + (x >> sh);
+            z  = z - a;
+        } else {
+            xi = x - (y >> sh);
+            yi = y - (x >> sh);
+            z  = z + a;
+        }
+        x = xi;
+        y = yi;
+        const T f = _hyperbolic_radix4_scale_fxd[2*j+d-1];
+        if ( f != _one_fxd ) c = mul_fxd( c, f );
+    }
+    x = mul_fxd( x, c );
+    y = mul_fxd( y, c );
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::destructed( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z, bool need_z ) const
 {
-    if ( logger != nullptr ) logger->destructed( &x, this );
+    T c = _hyperbolic_vectoring_gain_fxd;  // radix-2 gain divided by the radix-4 scale factor
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 1; j <= m; j++ )
+    {
+        const uint32_t d  = radix4_vectoring_digit( (y < 0) ? -y : y, (x < 0) ? -x : x, j, true );
+        if ( debug ) printf( "hyperbolic_vectoring_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (y < 0) ? int(d) : -int(d) );
+        if ( d == 0 ) continue;
+
+        const uint32_t sh = 2*j + 1 - d;
+        const T        a  = need_z ? hyperbolic_radix4_atanh( sh ) : T(0);
+        T xi;
+        T yi;
+        if ( y < 0 ) {
+            xi = x + (y >> sh);
+            yi = y + (x >> sh);
+            z  = z - a;
+        } else {
+            xi = x - (y >> sh);
+            yi = y - (x >> sh);
+            z  = z + a;
+        }
+        x = xi;
+        y = yi;
+        const T f = _hyperbolic_radix4_scale_fxd[2*j+d-1];
+        if ( f != _one_fxd ) c = mul_fxd( c, f );
+    }
+    x = mul_fxd( x, c );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_rotation_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 0; j <= m; j++ )
+    {
+        const T        p1 = _one_fxd >> (2*j);
+        const T        p2 = (j == 0) ? _two_fxd : (_one_fxd >> (2*j-1));
+        const uint32_t d  = radix4_rotation_digit( (z < 0) ? -z : z, p1, p2, true );
+        if ( debug ) printf( "linear_rotation_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (z < 0) ? -int(d) : int(d) );
+        if ( d == 0 ) continue;
+
+        const T xs = (d == 1) ? (x >> (2*j)) : (j == 0) ? (x << 1) : (x >> (2*j-1));
+        const T p  = (d == 1) ? p1 : p2;
+        if ( z >= 0 ) {
+            y = y + xs;
+            z = z - p;
+        } else {
+            y = y - xs;
+            z = z + p;
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_vectoring_radix4( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    x = x0;
+    y = y0;
+    z = z0;
+    uint32_t m = _radix4_m;
+    for( uint32_t j = 0; j <= m; j++ )
+    {
+        const uint32_t d  = radix4_vectoring_digit( (y < 0) ? -y : y, (x < 0) ? -x : x, j, true );
+        if ( debug ) printf( "linear_vectoring_radix4: j=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] d=%d\n", 
+                             j, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), (y < 0) ? int(d) : -int(d) );
+        if ( d == 0 ) continue;
+
+        const T xs = (d == 1) ? (x >> (2*j)) : (j == 0) ? (x << 1) : (x >> (2*j-1));
+        const T p  = (d == 1) ? (_one_fxd >> (2*j)) : (j == 0) ? _two_fxd : (_one_fxd >> (2*j-1));
+        if ( y < 0 ) {
+            y = y + xs;
+            z = z - p;
+        } else {
+            y = y - xs;
+            z = z + p;
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::constructed( const T& x ) const
+{
+    if ( logger_on() ) logger->constructed( &x, this );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::destructed( const T& x ) const
+{
+    if ( logger_on() ) logger->destructed( &x, this );
 }
 
-template< typename T, typename FLT >
-inline T&   Cordic<T,FLT>::assign( T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T&   Cordic<T,FLT,CORE>::assign( T& x, const T& y ) const
 {
     _log_2( assign, x, y );
     x = y;
     return x;
 }
 
-template< typename T, typename FLT >
-inline T&   Cordic<T,FLT>::pop_value( T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T&   Cordic<T,FLT,CORE>::pop_value( T& x, const T& y ) const
 {
     _log_2i( pop_value, x, y );
     x = y;
     return x;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::pop_bool( bool b ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::pop_bool( bool b ) const
 {
     _log_1i( pop_bool, b );
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::signbit( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::signbit( const T& x ) const                                     
 {
     return (x >> (_w-1)) & 1;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::frexp( const T& _x, int * e ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::frexp( const T& _x, int * e ) const
 {
     _log_1( frexp, _x );
     switch( fpclassify( _x ) )
@@ -2183,8 +4583,8 @@ inline T Cordic<T,FLT>::frexp( const T& _x, int * e ) const
     }
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::modf( const T& _x, T * i ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::modf( const T& _x, T * i ) const
 {
     if ( debug ) std::cout << "modf begin: x=" << _to_flt(_x) << "\n";
     _log_1( modf, _x );
@@ -2250,23 +4650,23 @@ T Cordic<T,FLT>::modf( const T& _x, T * i ) const
     return x;
 }
 
-template< typename T, typename FLT >
-int Cordic<T,FLT>::ilogb( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+int Cordic<T,FLT,CORE>::ilogb( const T& x ) const
 {
     int exp;
     (void)frexp( x, &exp );
     return exp;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::logb( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::logb( const T& x ) const
 {
     int exp = ilogb( x );
     return scalbn( _one, exp );
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fpclassify( const T& _x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fpclassify( const T& _x ) const                                     
 {
     T x = _x;
     EXP_CLASS x_exp_class;
@@ -2284,45 +4684,45 @@ inline int Cordic<T,FLT>::fpclassify( const T& _x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::iszero( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::iszero( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_ZERO;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isfinite( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isfinite( const T& x ) const                                     
 {
     int c = fpclassify( x );
     return c != FP_INFINITE && c != FP_NAN;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isinf( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isinf( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_INFINITE;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isnan( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isnan( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_NAN;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isnormal( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isnormal( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_NORMAL;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::issubnormal( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::issubnormal( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_SUBNORMAL;
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fesetround( int round )
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fesetround( int round )
 {
     switch( round )
     {
@@ -2333,6 +4733,7 @@ inline int Cordic<T,FLT>::fesetround( int round )
         case FE_AWAYFROMZERO:
         case FE_TONEAREST:
             _rounding_mode = round;
+            _memo_epoch++;
             return 0;
 
         default:
@@ -2340,14 +4741,14 @@ inline int Cordic<T,FLT>::fesetround( int round )
     }
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fegetround( void ) const
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fegetround( void ) const
 {
     return _rounding_mode;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nextafter( const T& from, const T& to ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nextafter( const T& from, const T& to ) const
 {
     _log_2( nextafter, from, to );
     if ( isequal( from, to ) ) {
@@ -2359,14 +4760,14 @@ inline T Cordic<T,FLT>::nextafter( const T& from, const T& to ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nexttoward( const T& from, long double to ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nexttoward( const T& from, long double to ) const
 {
     return nextafter( from, to_t(to) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::floor( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::floor( const T& x ) const
 {
     _log_1( floor, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2381,8 +4782,8 @@ inline T Cordic<T,FLT>::floor( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ceil( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ceil( const T& x ) const
 {
     _log_1( ceil, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2397,8 +4798,8 @@ inline T Cordic<T,FLT>::ceil( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::trunc( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::trunc( const T& x ) const
 {
     _log_1( trunc, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2413,8 +4814,8 @@ inline T Cordic<T,FLT>::trunc( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::extend( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::extend( const T& x ) const
 {
     _log_1( extend, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2430,8 +4831,8 @@ inline T Cordic<T,FLT>::extend( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::round( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::round( const T& x ) const
 {
     _log_1( round, x );
     T i;
@@ -2440,29 +4841,29 @@ inline T Cordic<T,FLT>::round( const T& x ) const
     return f;
 }
 
-template< typename T, typename FLT >
-inline long Cordic<T,FLT>::lround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long Cordic<T,FLT,CORE>::lround( const T& x ) const
 {
     // use round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline long long Cordic<T,FLT>::llround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long long Cordic<T,FLT,CORE>::llround( const T& x ) const
 {
     // use round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::iround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::iround( const T& x ) const
 {
     // same as round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rint( const T& x, int rmode ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rint( const T& x, int rmode ) const
 {
     if ( rmode < 0 ) rmode = _rounding_mode;
 
@@ -2478,35 +4879,35 @@ inline T Cordic<T,FLT>::rint( const T& x, int rmode ) const
     }
 }
 
-template< typename T, typename FLT >
-inline long Cordic<T,FLT>::lrint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long Cordic<T,FLT,CORE>::lrint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline long long Cordic<T,FLT>::llrint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long long Cordic<T,FLT,CORE>::llrint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::irint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::irint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nearbyint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nearbyint( const T& x ) const
 {
     return rint( x );                   // needs to make sure FE_INEXACT doesn't get raised
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rfrac( const T& _x, int rmode ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rfrac( const T& _x, int rmode ) const
 {
     if ( rmode < 0 ) rmode = _rounding_mode;
 
@@ -2520,39 +4921,48 @@ inline T Cordic<T,FLT>::rfrac( const T& _x, int rmode ) const
     deconstruct( x, x_exp_class, x_exp, x_sign );  // note that x will be non-negative after this
 
     x &= ~_guard_mask;
-
-    switch( rmode )
-    {
-        case FE_DOWNWARD:       if ( x_sign )  x += _min_fxd;                           break;
-        case FE_UPWARD:         if ( !x_sign ) x += _min_fxd;                           break;
-        case FE_TOWARDZERO:                                                             break;
-        case FE_AWAYFROMZERO:   x += x_sign ? -_min_fxd : _min_fxd;                     break;
-        case FE_TONEAREST:      if ( guard >= (1 << (_guard_w-1)) ) x += _min_fxd;      break;
-        default:                                                                        break;
-    }
+    if ( rfrac_up( guard, x_sign, rmode ) ) x += _min_fxd;
 
     if ( x_exp_class == EXP_CLASS::SUBNORMAL && x == 0 ) x_exp_class = EXP_CLASS::ZERO;
     reconstruct( x, x_exp_class, x_exp, x_sign );  
     return x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::floorfrac( const T& x ) const    { return rfrac( x, FE_DOWNWARD ); }
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::rfrac_up( const T& guard, bool sign, int rmode ) const
+{
+    //-----------------------------------------------------
+    // Shared by rfrac() and reconstruct_round().  The caller has the
+    // magnitude in hand, so "up" means away from zero.
+    //-----------------------------------------------------
+    switch( rmode )
+    {
+        case FE_DOWNWARD:       return sign;
+        case FE_UPWARD:         return !sign;
+        case FE_AWAYFROMZERO:   return true;
+        case FE_TONEAREST:      return guard >= (T(1) << (_guard_w-1));
+        case FE_TOWARDZERO:     
+        default:                return false;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::floorfrac( const T& x ) const    { return rfrac( x, FE_DOWNWARD ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ceilfrac( const T& x ) const     { return rfrac( x, FE_UPWARD ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ceilfrac( const T& x ) const     { return rfrac( x, FE_UPWARD ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::truncfrac( const T& x ) const    { return rfrac( x, FE_TOWARDZERO ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::truncfrac( const T& x ) const    { return rfrac( x, FE_TOWARDZERO ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::extendfrac( const T& x ) const   { return rfrac( x, FE_AWAYFROMZERO ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::extendfrac( const T& x ) const   { return rfrac( x, FE_AWAYFROMZERO ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::roundfrac( const T& x ) const    { return rfrac( x, FE_TONEAREST ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::roundfrac( const T& x ) const    { return rfrac( x, FE_TONEAREST ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg( const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg( const T& x, bool is_final ) const
 {
     if ( is_final ) _log_1( neg, x );
     T x_neg;
@@ -2569,14 +4979,14 @@ inline T Cordic<T,FLT>::neg( const T& x, bool is_final ) const
     return x_neg;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg( const T& x ) const
 {
     return neg( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::abs( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::abs( const T& x ) const
 {
     _log_1( abs, x );
     T x_abs = x;
@@ -2584,8 +4994,8 @@ inline T Cordic<T,FLT>::abs( const T& x ) const
     return x_abs;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::copysign( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::copysign( const T& x, const T& y ) const
 {
     _log_2( copysign, x, y );
     bool x_sign = signbit( x );
@@ -2593,27 +5003,27 @@ inline T Cordic<T,FLT>::copysign( const T& x, const T& y ) const
     return (x_sign != y_sign) ? neg( x, false ) : x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::add( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::add( const T& x, const T& y ) const
 {
 
     return add( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sub( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sub( const T& x, const T& y, bool is_final ) const
 {
     return add( x, neg( y, false ), is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sub( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sub( const T& x, const T& y ) const
 {
     return sub( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::add( const T& _x, const T& _y, bool is_final ) const
 {
     if ( is_final ) _log_2( add, _x, _y );
     T x = _x;  // will also contain the result
@@ -2687,10 +5097,11 @@ inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
                 x_exp_class = EXP_CLASS::NORMAL;
                 x_exp = 0;
             } else if ( x < _one_fxd ) {
-                while( x < _one_fxd && x_exp > _exp_unbiased_min )
-                {
-                    x_exp--;
-                    x <<= 1;
+                int32_t ls = int32_t(_frac_guard_w) - msb( x );
+                if ( ls > (x_exp - _exp_unbiased_min) ) ls = x_exp - _exp_unbiased_min;
+                if ( ls > 0 ) {
+                    x_exp -= ls;
+                    x <<= ls;
                 }
                 x_exp_class = (x_exp == _exp_unbiased_min) ? EXP_CLASS::SUBNORMAL : EXP_CLASS::NORMAL;
             }
@@ -2710,8 +5121,8 @@ inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
     return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbn( const T& _x, int ls, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbn( const T& _x, int ls, bool is_final ) const
 {
     if ( is_final ) _log_2i( scalbn, _x, T(ls) );
     T         x = _x;
@@ -2731,26 +5142,26 @@ T Cordic<T,FLT>::scalbn( const T& _x, int ls, bool is_final ) const
     return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbn( const T& x, int ls ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbn( const T& x, int ls ) const
 {
     return scalbn( x, ls, true );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbnn( const T& x, int rs ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbnn( const T& x, int rs ) const
 {
     return scalbn( x, -rs, true );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::ldexp( const T& x, int y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::ldexp( const T& x, int y ) const
 {
     return scalbn( x, y );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T& addend, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fma_fda( bool is_fma, const T& _x, const T& _y, const T& addend, bool is_final ) const
 {
     bool have_addend = !iszero( addend );
     if ( is_final ) {
@@ -2830,7 +5241,17 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
 
     } else {
         T xx, yy, zz;
-        if ( is_fma ) {
+        const bool is_native = _native_muldiv;
+        const bool is_engine = !is_fma && _div_engine != DIV_ENGINE::CORDIC;
+        if ( is_native || is_engine ) {
+            if ( x_exp_class == EXP_CLASS::SUBNORMAL ) normalize( x, x_exp );
+            if ( y_exp_class == EXP_CLASS::SUBNORMAL ) normalize( y, y_exp );
+        }
+        if ( is_native ) {
+            rr = is_fma ? mul_fxd_sticky( x, y ) : div_fxd_sticky( y, x );      // mantissas are in [1,2), so no overflow
+        } else if ( is_engine ) {
+            rr = div_engine_div( y, x );
+        } else if ( is_fma ) {
             linear_rotation( x, _zero, y, xx, rr, zz );
         } else {
             linear_vectoring( x, y, _zero, xx, yy, rr );
@@ -2859,41 +5280,129 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
     return rr;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fma( const T& x, const T& y, const T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fma( const T& x, const T& y, const T& addend ) const
+{
+    _n_for_scope( fma );
+    return fma_fda( true, x, y, addend, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul( const T& x, const T& y ) const
+{
+    _n_for_scope( mul );
+    _memo_2( mul, x, y, mul( x, y ) );
+    return fma( x, y, _zero );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul( const T& x, const T& y, bool is_final ) const
 {
-    return fma_fda( true, x, y, addend, true );
+    return fma_fda( true, x, y, _zero, is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mul( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+typename Cordic<T,FLT,CORE>::ConstMultiplier Cordic<T,FLT,CORE>::make_const_multiplier( FLT c ) const
 {
-    return fma( x, y, _zero );
+    return make_const_multiplier_t( to_t( c ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mul( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+typename Cordic<T,FLT,CORE>::ConstMultiplier Cordic<T,FLT,CORE>::make_const_multiplier_t( const T& c ) const
 {
-    return fma_fda( true, x, y, _zero, is_final );
+    //-----------------------------------------------------
+    // CSD recoding of the mantissa m, from the lsb up:
+    //     if m is odd, pick digit d = +1 if m%4 == 1, else -1, and m -= d
+    //     then m >>= 1
+    // No two adjacent digits are non-zero, so at most about half (typically a third) are.
+    //-----------------------------------------------------
+    ConstMultiplier cm;
+    cm.c = c;
+    T         m = c;
+    EXP_CLASS c_exp_class;
+    deconstruct( m, c_exp_class, cm.exp, cm.sign, false );
+    cm.is_normal = c_exp_class == EXP_CLASS::NORMAL;
+    if ( !cm.is_normal ) return cm;
+
+    for( int32_t p = 0; m != 0; p++, m >>= 1 )
+    {
+        if ( (m & 1) == 0 ) continue;
+        const bool is_neg = (m & 2) != 0;
+        m += is_neg ? 1 : -1;
+        cm.digits.push_back( typename ConstMultiplier::Digit{ int32_t(_frac_guard_w) - p, is_neg } );
+    }
+    if ( debug ) std::cout << "make_const_multiplier: c=" << _to_flt(c) << " digit_cnt=" << cm.digits.size() << "\n";
+    return cm;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const ConstMultiplier& c, bool is_final ) const
+{
+    if ( is_final ) _log_2i( mulc, x, c.c );
+    if ( !c.is_normal ) return mul( x, c.c, is_final );
+
+    T         m = x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( m, x_exp_class, x_exp, x_sign );
+    T r;
+    switch( x_exp_class )
+    {
+        case EXP_CLASS::NOT_A_NUMBER:
+            return x;
+
+        case EXP_CLASS::INFINITE:
+        case EXP_CLASS::ZERO:
+            r = 0;
+            reconstruct( r, x_exp_class, 0, x_sign != c.sign );
+            return r;
+
+        default:
+        {
+            // use the unused upper bits of T to keep the shifted-out bits until the end
+            const int32_t xw = int32_t( sizeof( T )*8 ) - int32_t(_frac_guard_w) - 5;
+            if ( xw > 0 ) m <<= xw;
+            r = 0;
+            for( const auto& d : c.digits )
+            {
+                const T t = (d.shift >= 0) ? (m >> d.shift) : (m << -d.shift);
+                r += d.is_neg ? -t : t;
+            }
+            if ( xw > 0 ) r = (r < 0) ? -rshift_sticky( -r, xw ) : rshift_sticky( r, xw );
+            reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, x_exp + c.exp, x_sign != c.sign );
+            if ( is_final ) r = rfrac( r );
+            return r;
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const ConstMultiplier& c ) const
+{
+    return mulc( x, c, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mulc( const T& x, const T& c, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const T& c, bool is_final ) const
 {
+    auto it = _const_multipliers->find( c );
+    if ( it != _const_multipliers->end() ) return mulc( x, it->second, is_final );
+
     if ( is_final ) _log_2i( mulc, x, c );
-    T r = mul( x, c, false );     // later, change this to minimum shifts and adds
+    T r = mul( x, c, false );     // not a constant we know about
     if ( is_final ) r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mulc( const T& x, const T& c ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const T& c ) const
 {
     return mulc( x, c, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqr( const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqr( const T& x, bool is_final ) const
 {
     if ( is_final ) _log_1( sqr, x );
     T r = mul( x, x, false );
@@ -2901,57 +5410,64 @@ inline T Cordic<T,FLT>::sqr( const T& x, bool is_final ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqr( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqr( const T& x ) const
 {
+    _n_for_scope( sqr );
     return sqr( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fda( const T& _y, const T& _x, const T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fda( const T& _y, const T& _x, const T& addend ) const
 {
+    _n_for_scope( fda );
     return fma_fda( false, _x, _y, addend, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::div( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div( const T& y, const T& x ) const
 {
+    _n_for_scope( div );
+    _memo_2( div, y, x, div( y, x ) );
     return fda( y, x, _zero );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::div( const T& y, const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div( const T& y, const T& x, bool is_final ) const
 {
     return fma_fda( false, x, y, _zero, is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::remainder( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::remainder( const T& y, const T& x ) const
 {
     return div( y, x );                 // FIXIT: placeholder
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fmod( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fmod( const T& y, const T& x ) const
 {
     return div( y, x );                 // FIXIT: placeholder
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::remquo( const T& y, const T& x, int * quo ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::remquo( const T& y, const T& x, int * quo ) const
 {
     return div( y, x );                 // FIXIT: placeholder
     *quo = 0;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rcp( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rcp( const T& x ) const
 {
+    _lookup_1( rcp, x );
+    _n_for_scope( rcp );
+    _memo_1( rcp, x, rcp( x ) );
     return div( _one, x );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::sqrt( const T& _x, bool is_final ) const
 { 
     //-----------------------------------------------------
     // Identities:
@@ -2983,11 +5499,16 @@ T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
     } else if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::INFINITE ) {
         // x is the answer
 
+    } else if ( _div_engine != DIV_ENGINE::CORDIC ) {
+        x = div_engine_sqrt( x << 2 );                                      // sqrt(4*s) = 2*sqrt(s)
+        reconstruct( x, x_exp_class, 0, x_sign );
+        do_rest = true;
+
     } else {
         T xx, yy;
         hyperbolic_vectoring_xy( x+_one_fxd, x-_one_fxd, xx, yy );        // gain*sqrt((s+1)^2 - (s-1)^2)
         reconstruct( xx, x_exp_class, 0, x_sign );
-        x = mulc( xx, _hyperbolic_vectoring_one_over_gain, false );
+        x = mulc( xx, *_hyperbolic_vectoring_one_over_gain_cm, false );
         do_rest = true;
     }
 
@@ -3003,27 +5524,72 @@ T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
     return x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt( const T& x ) const
 { 
+    _lookup_1( sqrt, x );
+    _n_for_scope( sqrt );
+    _memo_1( sqrt, x, sqrt( x ) );
     return sqrt( x, true );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rsqrt( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rsqrt( const T& x ) const
 { 
+    _lookup_1( rsqrt, x );
+    _n_for_scope( rsqrt );
+    _memo_1( rsqrt, x, rsqrt( x ) );
     //-----------------------------------------------------
-    // 1.0 / sqrt( x )
+    // Identities:
+    //     1/sqrt(m * 2^e) = 1/sqrt(a) * 2^(-k)    where a = m*2^(e-2k) is in [1,4)
+    // Strategy:
+    //     Split off an even exponent 2k, then rsqrt_kernel() does a seed lookup and a few 
+    //     Newton (or Goldschmidt) iterations.
     //-----------------------------------------------------
     _log_1( rsqrt, x );
-    T sq = sqrt( x, false );
-    T r = div( _one, sq );
-    if ( debug ) std::cout << "rsqrt end: x_orig=" << _to_flt(x) << " sqrt=" << _to_flt(sq) << " r=" << _to_flt(r, false) << "\n";
+    T         r = x;
+    EXP_CLASS r_exp_class;
+    int32_t   r_exp;
+    bool      r_sign;
+    deconstruct( r, r_exp_class, r_exp, r_sign );
+    if ( r_sign && r_exp_class != EXP_CLASS::NOT_A_NUMBER ) {
+        r_exp_class = (r_exp_class == EXP_CLASS::ZERO) ? EXP_CLASS::INFINITE : EXP_CLASS::NOT_A_NUMBER;
+    } else if ( r_exp_class == EXP_CLASS::ZERO ) {
+        r_exp_class = EXP_CLASS::INFINITE;
+    } else if ( r_exp_class == EXP_CLASS::INFINITE ) {
+        r_exp_class = EXP_CLASS::ZERO;
+    }
+    switch( r_exp_class )
+    {
+        case EXP_CLASS::NOT_A_NUMBER:
+            r |= _quiet_NaN_fxd;
+            reconstruct( r, r_exp_class, 0, r_sign );
+            break;
+
+        case EXP_CLASS::ZERO:
+        case EXP_CLASS::INFINITE:
+            reconstruct( r, r_exp_class, 0, r_sign );
+            break;
+
+        default:
+        {
+            if ( r_exp_class == EXP_CLASS::SUBNORMAL ) normalize( r, r_exp );
+            if ( r_exp & 1 ) {
+                r <<= 1;
+                r_exp--;
+            }
+            r = rsqrt_kernel( r );
+            reconstruct( r, EXP_CLASS::NORMAL, -(r_exp/2), false );
+            r = rfrac( r );
+            break;
+        }
+    }
+    if ( debug ) std::cout << "rsqrt end: x_orig=" << _to_flt(x) << " r=" << _to_flt(r, false) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rsqrt_orig( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rsqrt_orig( const T& x ) const
 { 
     //-----------------------------------------------------
     // x^(-1/2) = exp( log(x) / -2 );
@@ -3038,40 +5604,113 @@ T Cordic<T,FLT>::rsqrt_orig( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cbrt( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::cbrt_rcbrt( const T& _x, bool is_rcbrt ) const
+{ 
+    //-----------------------------------------------------
+    // Identities:
+    //     cbrt(m * 2^e)  = cbrt(a) * 2^k            where e = 3k + r, r in 0..2, a = m*2^r is in [1,8)
+    //     cbrt(a)        = a * rcbrt(a)^2
+    //     rcbrt(m * 2^e) = rcbrt(a) * 2^(-k)
+    // Strategy:
+    //     Split the exponent by 3, then rcbrt_kernel() does a seed lookup and a few Newton iterations.
+    //     The sign passes through.
+    //-----------------------------------------------------
+    T         x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    switch( x_exp_class )
+    {
+        case EXP_CLASS::NOT_A_NUMBER:
+            x |= _quiet_NaN_fxd;
+            reconstruct( x, x_exp_class, 0, x_sign );
+            break;
+
+        case EXP_CLASS::ZERO:
+            reconstruct( x, is_rcbrt ? EXP_CLASS::INFINITE : EXP_CLASS::ZERO, 0, x_sign );
+            break;
+
+        case EXP_CLASS::INFINITE:
+            reconstruct( x, is_rcbrt ? EXP_CLASS::ZERO : EXP_CLASS::INFINITE, 0, x_sign );
+            break;
+
+        default:
+        {
+            if ( x_exp_class == EXP_CLASS::SUBNORMAL ) normalize( x, x_exp );
+            int32_t k = x_exp / 3;
+            int32_t r = x_exp - 3*k;
+            if ( r < 0 ) {
+                r += 3;
+                k--;
+            }
+            const T a = x << r;
+            x = rcbrt_kernel( a );
+            if ( !is_rcbrt ) x = mul_fxd( a, mul_fxd( x, x ) );
+            reconstruct( x, EXP_CLASS::NORMAL, is_rcbrt ? -k : k, x_sign );
+            x = rfrac( x );
+            break;
+        }
+    }
+    if ( debug ) std::cout << (is_rcbrt ? "rcbrt" : "cbrt") << " end: x_orig=" << _to_flt(_x, false) << " r=" << _to_flt(x, false) << "\n";
+    return x;
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::cbrt( const T& x ) const
+{ 
+    _lookup_1( cbrt, x );
+    _n_for_scope( cbrt );
+    _memo_1( cbrt, x, cbrt( x ) );
+    _log_1( cbrt, x );
+    return cbrt_rcbrt( x, false );
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rcbrt( const T& x ) const
+{ 
+    _lookup_1( rcbrt, x );
+    _n_for_scope( rcbrt );
+    _memo_1( rcbrt, x, rcbrt( x ) );
+    _log_1( rcbrt, x );
+    return cbrt_rcbrt( x, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cbrt_orig( const T& _x ) const
 { 
     // x^(1/3) = exp( log(x) / 3 );
     _log_1( cbrt, _x );
     T x = _x;
     bool sign = signbit( x );
     if ( sign ) x = neg( x, false );
-    T r = exp( mulc( log( x, false ), _third, false ) );
-    if ( sign ) r = neg( x, false );
+    T r = exp( mulc( log( x, false ), *_third_cm, false ) );
+    if ( sign ) r = neg( r, false );
     r = rfrac( r );
     if ( debug ) std::cout << "cbrt end: x_orig=" << _to_flt(_x, false) << 
                               " x_reduced=" << _to_flt(x, false, true, false) << " r=" << _to_flt(r, false) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rcbrt( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rcbrt_orig( const T& _x ) const
 { 
     // x^(-1/3) = exp( log(x) / -3 );
     _log_1( rcbrt, _x );
     T x = _x;
     bool sign = signbit( x );
     if ( sign ) x = neg( x, false );
-    T r = exp( mulc( log( x, false ), _neg_third, false ) ); 
-    if ( sign ) r = neg( x, false );
+    T r = exp( mulc( log( x, false ), *_neg_third_cm, false ) ); 
+    if ( sign ) r = neg( r, false );
     r = rfrac( r );
     if ( debug ) std::cout << "rcbrt end: x_orig=" << _to_flt(_x, false) << 
                               " x_reduced=" << _to_flt(x, false, true, false) << " r=" << _to_flt(r, false) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::compare( const T& _x, const T& _y ) const
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::compare( const T& _x, const T& _y ) const
 {
     T         x = _x;
     T         y = _y;
@@ -3123,8 +5762,8 @@ inline int Cordic<T,FLT>::compare( const T& _x, const T& _y ) const
     }
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isgreater( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isgreater( const T& x, const T& y ) const
 {
     _log_2( isgreater, x, y );
     bool b = compare( x, y ) == 1;
@@ -3132,8 +5771,8 @@ inline bool Cordic<T,FLT>::isgreater( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isgreaterequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isgreaterequal( const T& x, const T& y ) const
 {
     _log_2( isgreaterequal, x, y );
     bool b = compare( x, y ) >= 0;
@@ -3141,8 +5780,8 @@ inline bool Cordic<T,FLT>::isgreaterequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isless( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isless( const T& x, const T& y ) const
 {
     _log_2( isless, x, y );
     bool b = compare( x, y ) == -1;
@@ -3150,8 +5789,8 @@ inline bool Cordic<T,FLT>::isless( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::islessequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::islessequal( const T& x, const T& y ) const
 {
     _log_2( islessequal, x, y );
     int cmp = compare( x, y );
@@ -3160,8 +5799,8 @@ inline bool Cordic<T,FLT>::islessequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::islessgreater( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::islessgreater( const T& x, const T& y ) const
 {
     _log_2( islessgreater, x, y );
     int cmp = compare( x, y );
@@ -3170,8 +5809,8 @@ inline bool Cordic<T,FLT>::islessgreater( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isunordered( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isunordered( const T& x, const T& y ) const
 {
     _log_2( isunordered, x, y );
     bool b = compare( x, y ) <= -2;   // either is a NaN
@@ -3179,8 +5818,8 @@ inline bool Cordic<T,FLT>::isunordered( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isunequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isunequal( const T& x, const T& y ) const
 {
     _log_2( isunequal, x, y );
     int cmp = compare( x, y );
@@ -3189,8 +5828,8 @@ inline bool Cordic<T,FLT>::isunequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isequal( const T& x, const T& y ) const
 {
     _log_2( isequal, x, y );
     int cmp = compare( x, y );
@@ -3199,32 +5838,32 @@ inline bool Cordic<T,FLT>::isequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fdim( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fdim( const T& x, const T& y ) const
 { 
     _log_2( fdim, x, y );
     T r = isgreaterequal( x, y ) ? sub( x, y, true ) : _zero;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fmax( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fmax( const T& x, const T& y ) const
 { 
     _log_2( fmax, x, y );
     T r = isgreaterequal( x, y ) ? x : y;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fmin( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fmin( const T& x, const T& y ) const
 { 
     _log_2( fmin, x, y );
     T r = isless( x, y ) ? x : y;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::exp( const T& _x, bool is_final, FLT b ) const
 { 
     //-----------------------------------------------------
     // Identities:
@@ -3237,6 +5876,10 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
     // Strategy:
     //     Call reduce_exp_arg() to get i and x=log(b)*f.
     //     Call hyperbolic_rotation() to get sinh(x) + cosh(x) in one shot.
+    //     For b != e and base_scaled_ok(2), x=f goes to hyperbolic_rotation() 
+    //     with the base-2 atanh_tbl instead, which saves the multiply by log(2).
+    //     With hyperbolic_neg_iter_set(), b == e and x within the extended range 
+    //     goes straight to hyperbolic_rotation() with i = 0.
     //-----------------------------------------------------
     if ( debug ) std::cout << "exp begin: x_orig=" << _to_flt(_x, is_final) << " b=" << b << "\n";
     if ( is_final ) _log_1( exp, _x );
@@ -3244,12 +5887,19 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
     int32_t i;
     EXP_CLASS x_exp_class;
     bool x_sign;
-    reduce_exp_arg( b, x, i, x_exp_class, x_sign ); 
+    const bool scaled = b != FLT(M_E) && base_scaled_ok( 2 );
+    if ( b == FLT(M_E) && hyperbolic_neg_arg( _x, _hyperbolic_neg_exp_min_fxd, x ) ) {
+        i           = 0;
+        x_exp_class = EXP_CLASS::NORMAL;
+        x_sign      = x < 0;
+    } else {
+        reduce_exp_arg( b, x, i, x_exp_class, x_sign, scaled ); 
+    }
 
     bool do_rest = false;
     if ( x_exp_class == EXP_CLASS::ZERO ) {
-        // one is the answer
-        x = _one;
+        // one is the answer, times 2^i if the reduced fraction came out 0 (e.g., exp2 of an integer)
+        x = (i == 0) ? _one : scalbn( _one, i, false );
 
     } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
         // 0 or +inf
@@ -3261,7 +5911,8 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
     
     } else {
         T xx, yy, zz;
-        hyperbolic_rotation( _hyperbolic_rotation_one_over_gain_fxd, _hyperbolic_rotation_one_over_gain_fxd, x, xx, yy, zz );
+        hyperbolic_rotation( _hyperbolic_rotation_one_over_gain_fxd, _hyperbolic_rotation_one_over_gain_fxd, x, xx, yy, zz, 
+                             scaled ? _base2_atanh_fxd : nullptr );
         if ( debug ) std::cout << "exp mid: b=" << b << " x_orig=" << _to_flt(_x, is_final) << 
                                   " i=" << i << " exp(log(2)*f)=" << _to_flt(xx, false, true) << "\n";
         reconstruct( xx, x_exp_class, 0, false );
@@ -3273,65 +5924,147 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
     return x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp( const T& x ) const
 { 
+    _lookup_1( exp, x );
+    _n_for_scope( exp );
+    _memo_1( exp, x, exp( x ) );
     return exp( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::expm1( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::expm1( const T& x ) const
 { 
+    _lookup_1( expm1, x );
+    _n_for_scope( expm1 );
+    _memo_1( expm1, x, expm1( x ) );
     //-----------------------------------------------------
     // Compute without rounding, then round.
     //-----------------------------------------------------
     return sub( exp( x, false ), one() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::expc( const FLT& b, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::expc( const FLT& b, const T& x ) const
 { 
+    _n_for_scope( expc );
     return exp( x, true, b );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp2( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp2( const T& x ) const
 { 
+    _lookup_1( exp2, x );
+    _n_for_scope( exp2 );
+    _memo_1( exp2, x, exp2( x ) );
     return expc( 2.0, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp10( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp10( const T& x ) const
 { 
+    _lookup_1( exp10, x );
+    _n_for_scope( exp10 );
+    _memo_1( exp10, x, exp10( x ) );
     return expc( 10.0, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pow( const T& b, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pow( const T& b, const T& x ) const
 { 
+    _n_for_scope( pow );
+    _memo_2( pow, b, x, pow( b, x ) );
     if ( debug ) std::cout << "pow begin: b=" << _to_flt(b) << " x=" << _to_flt(x) << "\n";
     _log_2( pow, b, x );
-    T lg_b = log( b, false );
-    T m  = mul( x, lg_b, false );
-    T r = exp( m, false );
+    T r;
+    int32_t k;
+    if ( pow_int_exp( b, x, k ) ) {
+        // exponentiation by squaring, then one reciprocal for k < 0
+        r = _one;
+        T p = b;
+        bool r_is_one = true;                                           // saves the first mul() by 1
+        for( uint32_t u = (k < 0) ? -k : k; u != 0; )
+        {
+            if ( u & 1 ) {
+                r = r_is_one ? p : mul( r, p, false );
+                r_is_one = false;
+            }
+            u >>= 1;
+            if ( u != 0 ) p = mul( p, p, false );
+        }
+        if ( k < 0 ) r = div( _one, r, false );
+    } else {
+        T lg_b = log( b, false );
+        T m  = mul( x, lg_b, false );
+        r = exp( m, false );
+    }
     r = rfrac( r );
     if ( debug ) std::cout << "pow end: b=" << _to_flt(b) << " x=" << _to_flt(x) << " pow=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::pow_int_exp( const T& b, const T& x, int32_t& k ) const
+{
+    //-----------------------------------------------------
+    // Inspect the exponent and fraction bits directly rather than calling modf(),
+    // which would do (and log) a full OP.
+    //-----------------------------------------------------
+    T bb = b;
+    EXP_CLASS b_exp_class;
+    int32_t b_exp;
+    bool b_sign;
+    deconstruct( bb, b_exp_class, b_exp, b_sign, false );
+    if ( b_exp_class == EXP_CLASS::INFINITE || b_exp_class == EXP_CLASS::NOT_A_NUMBER ) return false;
+
+    if ( !_is_float ) {
+        if ( (x & _frac_guard_mask) != 0 ) return false;
+        const T i = x >> _frac_guard_w;
+        if ( i < -T(POW_INT_MAX) || i > T(POW_INT_MAX) ) return false;
+        k = int32_t( i );
+        return true;
+    }
+
+    T m = x;
+    EXP_CLASS x_exp_class;
+    int32_t x_exp;
+    bool x_sign;
+    deconstruct( m, x_exp_class, x_exp, x_sign, false );
+    if ( x_exp_class == EXP_CLASS::ZERO ) {
+        k = 0;
+        return true;
+    }
+    if ( x_exp_class != EXP_CLASS::NORMAL || x_exp < 0 || x_exp >= int32_t(_frac_guard_w) ) return false;
+    const uint32_t shift = _frac_guard_w - x_exp;
+    if ( (m & ((T(1) << shift) - 1)) != 0 ) return false;
+    const T i = m >> shift;
+    if ( i > T(POW_INT_MAX) ) return false;
+    k = x_sign ? -int32_t( i ) : int32_t( i );
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& _x, bool is_final, FLT b ) const
 { 
     //-----------------------------------------------------
-    // log(x) = 2*atanh2(x-1, x+1);
+    // log(x)   = 2*atanh2(x-1, x+1);
+    // log_b(x) = log(x)/log(b), or directly with the scaled atanh table if base_scaled_ok(b)
     //-----------------------------------------------------
-    if ( debug ) std::cout << "log begin: x_orig=" << _to_flt(_x) << " is_final=" << is_final << "\n";
+    if ( debug ) std::cout << "log begin: x_orig=" << _to_flt(_x) << " is_final=" << is_final << " b=" << b << "\n";
     if ( is_final ) _log_1( log, _x );
+    if ( b != FLT(M_E) && !base_scaled_ok( b ) ) {
+        const T one_over_log_b = to_t( FLT(1) / std::log( b ) );
+        T r = mulc( log( _x, false ), one_over_log_b, false );
+        if ( is_final ) r = rfrac( r );
+        return r;
+    }
+    const T * atanh_tbl = (b != FLT(M_E)) ? base_scaled_atanh( b ) : nullptr;
     T x = _x;
     EXP_CLASS x_exp_class;
     bool x_sign;
     T addend;
-    reduce_log_arg( x, x_exp_class, x_sign, addend );                        // does not deconstruct value
+    reduce_log_arg( x, x_exp_class, x_sign, addend, b );                     // does not deconstruct value
     T r;
     if ( x_exp_class == EXP_CLASS::ZERO ) {
         // -inf
@@ -3357,7 +6090,7 @@ inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
         T x_m1 = sub( x, _one, false );
         T x_p1 = add( x, _one, false );
         T dv   = div( x_m1, x_p1, false );
-        T lg1  = atanh2( dv, _one, false, true );
+        T lg1  = atanh2( dv, _one, false, true, atanh_tbl );
         T lg2  = scalbn( lg1, 1, false );
           r    = add( lg2, addend, false );
         if ( is_final ) r = rfrac( r );
@@ -3368,27 +6101,34 @@ inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& _x ) const
 { 
+    _lookup_1( log, _x );
+    _n_for_scope( log );
+    _memo_1( log, _x, log( _x ) );
     return log( _x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log1p( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log1p( const T& _x, bool is_final ) const
 { 
     return log( add( _x, _one, is_final ), is_final );   
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log1p( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log1p( const T& _x ) const
 { 
+    _lookup_1( log1p, _x );
+    _n_for_scope( log1p );
+    _memo_1( log1p, _x, log1p( _x ) );
     return log1p( _x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& x, const T& b ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& x, const T& b ) const
 { 
+    _n_for_scope( logn );
     _log_2( logn, x, b );
     T lgx = log( x, false );
     T lgb = log( b, false );
@@ -3398,55 +6138,57 @@ inline T Cordic<T,FLT>::log( const T& x, const T& b ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::logc( const T& x, const FLT& b ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::logc( const T& x, const FLT& b ) const
 { 
+    _n_for_scope( logc );
     _log_2f( logc, x, b );
-    const FLT  one_over_log_b_f = FLT(1) / std::log( b );
-    const T    one_over_log_b   = to_t( one_over_log_b_f );
-          T    log_x            = log( x, false );
-    T r = mulc( log_x, one_over_log_b, false );
+    T r = log( x, false, b );
     r = rfrac( r );
     if ( debug ) std::cout << "logc: b=" << _to_flt(b) << " x=" << _to_flt(x) << " reduced_x=" << _to_flt(x, false, true) << " log=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log2( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log2( const T& x ) const
 { 
+    _lookup_1( log2, x );
+    _n_for_scope( log2 );
+    _memo_1( log2, x, log2( x ) );
     return logc( x, 2.0 );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log10( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log10( const T& x ) const
 { 
+    _lookup_1( log10, x );
+    _n_for_scope( log10 );
+    _memo_1( log10, x, log10( x ) );
     return logc( x, 10.0 );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::deg2rad( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::deg2rad( const T& x ) const
 {
     _log_1( deg2rad, x );
-    T _180 = to_t( FLT(180) );
-    T r = mulc( x, _180, false );
-      r = mulc( r, _one_div_pi, false );
+    T r = mulc( x, *_180_cm, false );
+      r = mulc( r, *_one_div_pi_cm, false );
       r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rad2deg( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rad2deg( const T& x ) const
 {
     _log_1( rad2deg, x );
-    T ONE_DIV_180 = to_t( FLT(1) / FLT(180) );
-    T r = mulc( x, _pi, false );
-      r = mulc( r, ONE_DIV_180, false );
+    T r = mulc( x, *_pi_cm, false );
+      r = mulc( r, *_one_div_180_cm, false );
       r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * _r ) const             
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * _r ) const             
 { 
     if ( is_final ) {
         if ( _r != nullptr ) {
@@ -3466,17 +6208,74 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
     T x = _x;
 
     //-----------------------------------------------------
-    // reduce_sincos_arg() will get x in the range 0 .. PI/2 and tell us the quadrant.
-    // It will then check if x is still > PI/4 and, if so, subtract PI/4 and
-    // set did_minus_pi_div_4.  If did_minus_pi_div_4 is true, then we need
-    // to do some adjustments below after the cordic routine completes.
+    // reduce_sincos_arg() will get x in the range -PI/4 .. PI/4 and tell us the quadrant.
+    // sincos_fixup() then only needs to swap and negate.
     //-----------------------------------------------------
     uint32_t quadrant;
     EXP_CLASS x_exp_class;
     bool x_sign;
-    bool did_minus_pi_div_4;
-    reduce_sincos_arg( times_pi, x, quadrant, x_exp_class, x_sign, did_minus_pi_div_4 );
+    reduce_sincos_arg( times_pi, x, quadrant, x_exp_class, x_sign );
+
+    //-----------------------------------------------------
+    // r*sin(x) and r*cos(x) come straight out of circular_rotation() when
+    // x0 is r's mantissa times 1/gain.  r's exponent and sign are applied by sincos_fixup().
+    //-----------------------------------------------------
+    int32_t r_exp  = 0;
+    bool    r_sign = false;
+    if ( x_exp_class == EXP_CLASS::NORMAL ) {
+        T x0 = _circular_rotation_one_over_gain_fxd;
+        if ( fold_r( _r, _circular_rotation_one_over_gain_fxd, x0, r_exp, r_sign ) ) _r = nullptr;
+        T zz;
+        circular_rotation( x0, _zero, x, co, si, zz );
+    }
+    sincos_fixup( _x, x, x_exp_class, x_sign, quadrant, si, co, is_final, need_si, need_co, r_exp, r_sign, _r );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::fold_r( const T * r, const T& one_over_gain, T& x0, int32_t& r_exp, bool& r_sign ) const
+{
+    r_exp  = 0;
+    r_sign = false;
+    x0     = one_over_gain;
+    if ( r == nullptr ) return true;
+
+    T         m = *r;
+    EXP_CLASS r_exp_class;
+    deconstruct( m, r_exp_class, r_exp, r_sign );
+    if ( r_exp_class == EXP_CLASS::SUBNORMAL ) {
+        normalize( m, r_exp );
+    } else if ( r_exp_class != EXP_CLASS::NORMAL ) {
+        r_exp  = 0;
+        r_sign = false;
+        return false;
+    }
+    x0 = T( (T2( m ) * T2( one_over_gain )) >> (_frac_guard_w + 1) );    // halved to keep |x0| <= 1
+    r_exp++;
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::hyperbolic_neg_arg( const T& x, const T& neg_max, T& z ) const
+{
+    if ( _hyperbolic_neg_iter_cnt == 0 || !_is_float ) return false;
+
+    T         v = x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( v, x_exp_class, x_exp, x_sign );
+    if ( (x_exp_class != EXP_CLASS::NORMAL && x_exp_class != EXP_CLASS::SUBNORMAL) || x_exp > 4 ) return false;   // extended range is < 32
+
+    v = (x_exp >= 0) ? (v << x_exp) : rshift_sticky( v, -x_exp );
+    if ( v > (x_sign ? neg_max : _hyperbolic_neg_angle_max_fxd) ) return false;
+    z = x_sign ? -v : v;
+    return true;
+}
 
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos_fixup( const T& _x, T x, EXP_CLASS x_exp_class, bool x_sign, uint32_t quadrant,
+                                  T& si, T& co, bool is_final, bool need_si, bool need_co, int32_t r_exp, bool r_sign, const T * _r ) const
+{
     // check for special cases
     //
     if ( x_exp_class == EXP_CLASS::ZERO ) {
@@ -3484,6 +6283,10 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
         // co = 1
         if ( need_si ) si = _x;
         if ( need_co ) co = signbit(_x) ? _neg_one : _one;
+        if ( _r != nullptr ) {
+            if ( need_si ) si = mul( si, *_r, false );
+            if ( need_co ) co = mul( co, *_r, false );
+        }
 
     } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER || x_exp_class == EXP_CLASS::INFINITE ) {
         // NaN
@@ -3494,28 +6297,33 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
         if ( need_co ) co = x;
 
     } else {
-        T zz;
-        circular_rotation( _circular_rotation_one_over_gain_fxd, _zero, x, co, si, zz );
-
-        if ( si < 0 ) si = 0;                   // FIXIT: temporary hack when x is tiny
-        if ( co < 0 ) co = 0;
-        reconstruct( si, (si == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, false );
-        reconstruct( co, (co == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, false );
-
         //-----------------------------------------------------
-        // If did_minus_pi_div_4 is true, then we need to perform this
-        // modification for sin and cos:
-        //
-        // sin(x+PI/4) = sqrt(2)/2 * ( sin(x) + cos(x) )
-        // cos(x+PI/4) = sqrt(2)/2 * ( cos(x) - sin(x) )
+        // co and si hold the fixed-point circular_rotation() results,
+        // already scaled by the mantissa of a folded r.  The reduced
+        // angle can be negative, so si can be too.
         //-----------------------------------------------------
-        if ( did_minus_pi_div_4 ) {
-            T si_new = mulc( add( si, co, false ), _sqrt2_div_2, false );
-            T co_new = mulc( sub( co, si, false ), _sqrt2_div_2, false );
-            si = si_new;
-            co = co_new;
+        if ( _is_float && _r == nullptr ) {
+            //-----------------------------------------------------
+            // Common case: do the quadrant swap on the fixed-point values,
+            // fold the quadrant negations into the signs, then pack and 
+            // round each result once.
+            //-----------------------------------------------------
+            const T    vs = (quadrant&1) ? co : si;
+            const T    vc = (quadrant&1) ? si : co;
+            const bool s_sign = (r_sign != (vs < 0)) ^ (need_si && (x_sign ^ (quadrant >= 2)));
+            const bool c_sign = (r_sign != (vc < 0)) ^ (need_co && ((quadrant == 1) || quadrant == 2));
+            if ( need_si ) si = reconstruct_round( (vs < 0) ? -vs : vs, r_exp, s_sign, is_final );
+            if ( need_co ) co = reconstruct_round( (vc < 0) ? -vc : vc, r_exp, c_sign, is_final );
+            return;
         }
 
+        const bool si_neg = si < 0;
+        const bool co_neg = co < 0;
+        if ( si_neg ) si = -si;
+        if ( co_neg ) co = -co;
+        reconstruct( si, (si == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, r_sign != si_neg );
+        reconstruct( co, (co == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, r_sign != co_neg );
+
         //-----------------------------------------------------
         // Next, make adjustments for the quadrant.
         //-----------------------------------------------------
@@ -3528,10 +6336,7 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
         if ( need_co && (         (quadrant == 1) || quadrant == 2) ) co = neg( co, false );
 
         if ( _r != nullptr ) {
-            //-----------------------------------------------------
-            // Keep it simple for now.
-            // Don't attempt to include r in the circular_rotation().
-            //-----------------------------------------------------
+            // r is zero, infinite or NaN, so it was not folded
             if ( need_si ) si = mul( si, *_r, false );
             if ( need_co ) co = mul( co, *_r, false );
         }
@@ -3543,9 +6348,92 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sin( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos_batch( bool times_pi, const T * _x, T * si, T * co, size_t cnt, const T * _r ) const
+{
+    //-----------------------------------------------------
+    // Same steps as sincos(), but the circular_rotation() for
+    // each chunk of arguments is done by one circular_rotation_batch().
+    //
+    // For floating-point formats with no r, a normal argument is decoded
+    // inline and reduced by reduce_sincos_arg_fxd(), and its results are packed
+    // by reconstruct_round(), so the per-element work around the batch rotation 
+    // is plain integer code.  These are the same kernels that reduce_sincos_arg() 
+    // and sincos_fixup() use, so results match sincos() bit for bit.
+    // Other arguments take the general per-element path.
+    //-----------------------------------------------------
+    static constexpr size_t CHUNK = 64;
+    T         x[CHUNK];
+    T         x0[CHUNK];
+    T         y0[CHUNK];
+    T         z0[CHUNK];
+    T         rco[CHUNK];
+    T         rsi[CHUNK];
+    uint32_t  quadrant[CHUNK];
+    EXP_CLASS x_exp_class[CHUNK];
+    bool      x_sign[CHUNK];
+    int32_t   r_exp[CHUNK];
+    bool      r_sign[CHUNK];
+    bool      r_folded[CHUNK];
+    for( size_t b = 0; b < cnt; b += CHUNK )
+    {
+        const size_t chunk_cnt = ((cnt - b) < CHUNK) ? (cnt - b) : CHUNK;
+        for( size_t k = 0; k < chunk_cnt; k++ )
+        {
+            if ( _r != nullptr ) {
+                if ( times_pi ) {
+                    _log_4( sinpicospi, _x[b+k], si[b+k], co[b+k], _r[b+k] );
+                } else {
+                    _log_4( sincos, _x[b+k], si[b+k], co[b+k], _r[b+k] );
+                }
+            } else {
+                if ( times_pi ) {
+                    _log_3( sinpicospi, _x[b+k], si[b+k], co[b+k] );
+                } else {
+                    _log_3( sincos, _x[b+k], si[b+k], co[b+k] );
+                }
+            }
+            x[k] = _x[b+k];
+            y0[k] = _zero;
+            if ( _is_float && _r == nullptr ) {
+                const int32_t x_exp = int32_t( (x[k] >> _frac_guard_w) & _exp_mask ) - _exp_bias;
+                if ( x_exp > _exp_unbiased_min && x_exp < int32_t(_exp_mask) - _exp_bias && (times_pi || x_exp < _payne_hanek_exp_min) &&
+                     reduce_sincos_arg_fxd( times_pi, (x[k] & _frac_guard_mask) | (T(1) << _frac_guard_w), x_exp, z0[k], quadrant[k] ) ) {
+                    x_exp_class[k] = EXP_CLASS::NORMAL;
+                    x_sign[k]      = (x[k] >> (_w-1)) & 1;
+                    r_exp[k]       = 0;
+                    r_sign[k]      = false;
+                    r_folded[k]    = true;
+                    x0[k]          = _circular_rotation_one_over_gain_fxd;
+                    continue;
+                }
+            }
+            reduce_sincos_arg( times_pi, x[k], quadrant[k], x_exp_class[k], x_sign[k] );
+            r_folded[k] = fold_r( (_r != nullptr && x_exp_class[k] == EXP_CLASS::NORMAL) ? &_r[b+k] : nullptr, 
+                                  _circular_rotation_one_over_gain_fxd, x0[k], r_exp[k], r_sign[k] );
+            z0[k] = (x_exp_class[k] == EXP_CLASS::NORMAL) ? x[k] : _zero_fxd;
+        }
+
+        circular_rotation_batch( x0, y0, z0, rco, rsi, z0, chunk_cnt );
+
+        for( size_t k = 0; k < chunk_cnt; k++ )
+        {
+            const T x_orig = _x[b+k];
+            const bool need_r_mul = _r != nullptr && (x_exp_class[k] != EXP_CLASS::NORMAL || !r_folded[k]);
+            sincos_fixup( x_orig, x[k], x_exp_class[k], x_sign[k], quadrant[k], 
+                          rsi[k], rco[k], true, true, true, r_exp[k], r_sign[k], need_r_mul ? &_r[b+k] : nullptr );
+            si[b+k] = rsi[k];
+            co[b+k] = rco[k];
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sin( const T& x, const T * r ) const
 { 
+    _lookup_1r( sin, x );
+    _n_for_scope( sin );
+    _memo_1r( sin, x, sin( x ) );
     if ( r != nullptr ) {
         _log_2( sin, x, *r );
     } else {
@@ -3559,9 +6447,12 @@ inline T Cordic<T,FLT>::sin( const T& x, const T * r ) const
     return si;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cos( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cos( const T& x, const T * r ) const
 { 
+    _lookup_1r( cos, x );
+    _n_for_scope( cos );
+    _memo_1r( cos, x, cos( x ) );
     if ( r != nullptr ) {
         _log_2( cos, x, *r );
     } else {
@@ -3575,17 +6466,28 @@ inline T Cordic<T,FLT>::cos( const T& x, const T * r ) const
     return co;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sincos( const T& x, T& si, T& co, const T * r ) const             
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sincos( const T& x, T& si, T& co, const T * r ) const             
 {
+    _n_for_scope( sincos );
     sincos( false, x, si, co, true, true, true, r );
     if ( debug ) std::cout << "sincos end: x_orig=" << _to_flt(x) << " sin=" << _to_flt(si) << " cos=" << _to_flt(co) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tan( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sincos_batch( const T * x, T * si, T * co, size_t cnt, const T * r ) const             
+{
+    _n_for_scope( sincos );
+    sincos_batch( false, x, si, co, cnt, r );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tan( const T& x ) const
 { 
+    _lookup_1( tan, x );
+    _n_for_scope( tan );
+    _memo_1( tan, x, tan( x ) );
     _log_1( tan, x );
     T si, co;
     sincos( false, x, si, co, false, true, true, nullptr );
@@ -3595,9 +6497,12 @@ inline T Cordic<T,FLT>::tan( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sinpi( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sinpi( const T& x, const T * r ) const
 { 
+    _lookup_1r( sinpi, x );
+    _n_for_scope( sinpi );
+    _memo_1r( sinpi, x, sinpi( x ) );
     if ( r != nullptr ) {
         _log_2( sinpi, x, *r );
     } else {
@@ -3611,9 +6516,12 @@ inline T Cordic<T,FLT>::sinpi( const T& x, const T * r ) const
     return si;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cospi( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cospi( const T& x, const T * r ) const
 { 
+    _lookup_1r( cospi, x );
+    _n_for_scope( cospi );
+    _memo_1r( cospi, x, cospi( x ) );
     if ( r != nullptr ) {
         _log_2( cospi, x, *r );
     } else {
@@ -3627,17 +6535,28 @@ inline T Cordic<T,FLT>::cospi( const T& x, const T * r ) const
     return co;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sinpicospi( const T& x, T& si, T& co, const T * r ) const             
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinpicospi( const T& x, T& si, T& co, const T * r ) const             
 {
+    _n_for_scope( sinpicospi );
     sincos( true, x, si, co, true, true, true, r );
     if ( debug ) std::cout << "sinpicospi end: x_orig=" << _to_flt(x) << " sinpi=" << _to_flt(si) << " cospi=" << _to_flt(co) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tanpi( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinpicospi_batch( const T * x, T * si, T * co, size_t cnt, const T * r ) const             
+{
+    _n_for_scope( sinpicospi );
+    sincos_batch( true, x, si, co, cnt, r );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tanpi( const T& x ) const
 { 
+    _lookup_1( tanpi, x );
+    _n_for_scope( tanpi );
+    _memo_1( tanpi, x, tanpi( x ) );
     _log_1( tan, x );
     T si, co;
     sincos( true, x, si, co, false, true, true, nullptr );
@@ -3647,9 +6566,12 @@ inline T Cordic<T,FLT>::tanpi( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::asin( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::asin( const T& x ) const
 { 
+    _lookup_1( asin, x );
+    _n_for_scope( asin );
+    _memo_1( asin, x, asin( x ) );
     _log_1( asin, x );
     T nh = hypoth( _one, x, false );
     T r = atan2( x, nh, false, false, nullptr );
@@ -3658,9 +6580,12 @@ inline T Cordic<T,FLT>::asin( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::acos( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::acos( const T& x ) const
 { 
+    _lookup_1( acos, x );
+    _n_for_scope( acos );
+    _memo_1( acos, x, acos( x ) );
     _log_1( acos, x );
     T nh = hypoth( _one, x, false );
     T r = atan2( nh, x, false, false, nullptr );
@@ -3669,24 +6594,29 @@ inline T Cordic<T,FLT>::acos( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atan( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atan( const T& x ) const
 { 
+    _lookup_1( atan, x );
+    _n_for_scope( atan );
+    _memo_1( atan, x, atan( x ) );
     T r = atan2( x, _one, true, true, nullptr );
     if ( debug ) std::cout << "atan end: x_orig=" << _to_flt(x) << " atan=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atan2( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atan2( const T& y, const T& x ) const
 { 
+    _n_for_scope( atan2 );
+    _memo_2( atan2, y, x, atan2( y, x ) );
     T r = atan2( y, x, true, false, nullptr );
     if ( debug ) std::cout << "atan2 end: y=" << _to_flt(y) << " x=" << _to_flt(x) << " atan2=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one, T * r ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one, T * r ) const
 { 
     if ( is_final ) _log_2( atan2, _y, _x );
     T y = _y;
@@ -3756,6 +6686,7 @@ T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one,
     }
 
     bool      rr_sign = signbit(x) ^ signbit(y);
+    const bool quot_sign = rr_sign;
     EXP_CLASS exp_class;
     int32_t   exp;
     bool      swapped;
@@ -3780,6 +6711,7 @@ T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one,
         // reduce
         T xx, yy;
         circular_vectoring( x, y, _zero, xx, yy, rr );
+        if ( rr == 0 ) exp_class = EXP_CLASS::ZERO;                              // exact, e.g. with early_exit_set(true)
 
         did_neg = rr < 0;
         if ( did_neg ) {
@@ -3790,7 +6722,7 @@ T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one,
 
     reconstruct( rr, exp_class, 0, rr_sign );
     rr = scalbn( rr, 1, false );
-    if ( swapped ) rr = sub( did_neg ? _neg_pi : _pi, rr, false );
+    if ( swapped ) rr = sub( quot_sign ? _neg_pi : _pi, rr, false );   // atan(a/b) = sign(a/b)*PI/2 - atan(b/a)
     if ( is_final ) rr = rfrac( rr );
     if ( debug ) std::cout << "atan2 end: y=" << _to_flt(_y) << " x=" << _to_flt(_x) << " x_is_one=" << x_is_one << 
                               " swapped=" << swapped << " did_neg=" << did_neg << " atan2=" << _to_flt(rr) << 
@@ -3798,9 +6730,10 @@ T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one,
     return rr;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::polar_to_rect( const T& r, const T& a, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::polar_to_rect( const T& r, const T& a, T& x, T& y ) const
 {
+    _n_for_scope( polar_to_rect );
     _log_4( polar_to_rect, r, a, x, y );
     if ( debug ) std::cout << "polar_to_rect begin: r=" << _to_flt(r) << " a=" << _to_flt(a) << "\n";
     sincos( false, a, y, x, false, true, true, &r );
@@ -3808,9 +6741,10 @@ inline void Cordic<T,FLT>::polar_to_rect( const T& r, const T& a, T& x, T& y ) c
     y = rfrac( y );
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::rect_to_polar( const T& x, const T& y, T& r, T& a ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::rect_to_polar( const T& x, const T& y, T& r, T& a ) const
 {
+    _n_for_scope( rect_to_polar );
     _log_4( rect_to_polar, x, y, r, a );
     if ( debug ) std::cout << "rect_to_polar begin: x=" << _to_flt(x) << " y=" << _to_flt(y) << "\n";
     a = atan2( y, x, false, false, &r );
@@ -3818,8 +6752,8 @@ inline void Cordic<T,FLT>::rect_to_polar( const T& x, const T& y, T& r, T& a ) c
     a = rfrac( a );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypot( const T& _x, const T& _y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypot( const T& _x, const T& _y, bool is_final ) const
 {
     if ( is_final ) _log_2( hypot, _x, _y );
     T x = _x;
@@ -3835,21 +6769,23 @@ inline T Cordic<T,FLT>::hypot( const T& _x, const T& _y, bool is_final ) const
         circular_vectoring_xy( x, y, xx, yy );
     } 
     reconstruct( xx, exp_class, exp, false );
-    xx = mulc( xx, _circular_vectoring_one_over_gain, false );
+    xx = mulc( xx, *_circular_vectoring_one_over_gain_cm, false );
     if ( is_final ) xx = rfrac( xx );
     if ( debug ) std::cout << "hypot end: x_orig=" << _to_flt(_x, is_final) << 
                                         " y_orig=" << _to_flt(_y, is_final) << " hypot=" << _to_flt(xx, is_final) << "\n";
     return xx;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypot( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypot( const T& x, const T& y ) const
 {
+    _n_for_scope( hypot );
+    _memo_2( hypot, x, y, hypot( x, y ) );
     return hypot( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypoth( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypoth( const T& x, const T& y, bool is_final ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -3868,15 +6804,19 @@ inline T Cordic<T,FLT>::hypoth( const T& x, const T& y, bool is_final ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypoth( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypoth( const T& x, const T& y ) const
 {
+    _n_for_scope( hypoth );
     return hypoth( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sinh( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sinh( const T& x, const T * r ) const
 { 
+    _lookup_1r( sinh, x );
+    _n_for_scope( sinh );
+    _memo_1r( sinh, x, sinh( x ) );
     if ( r != nullptr ) {
         _log_2( sinh, x, *r );
     } else {
@@ -3890,9 +6830,12 @@ inline T Cordic<T,FLT>::sinh( const T& x, const T * r ) const
     return sih;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cosh( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cosh( const T& x, const T * r ) const
 { 
+    _lookup_1r( cosh, x );
+    _n_for_scope( cosh );
+    _memo_1r( cosh, x, cosh( x ) );
     if ( r != nullptr ) {
         _log_2( cosh, x, *r );
     } else {
@@ -3906,16 +6849,17 @@ inline T Cordic<T,FLT>::cosh( const T& x, const T * r ) const
     return coh;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sinhcosh( const T& x, T& sih, T& coh, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinhcosh( const T& x, T& sih, T& coh, const T * r ) const
 { 
+    _n_for_scope( sinhcosh );
     sinhcosh( x, sih, coh, true, true, true, r );
     if ( debug ) std::cout << "sinhcosh end: x_orig=" << _to_flt(x) << " sinh=" << _to_flt(sih) << " cosh=" << _to_flt(coh) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * _r ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * _r ) const
 { 
     if ( is_final ) {
         if ( _r != nullptr ) {
@@ -3925,24 +6869,75 @@ void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool n
         }
     }
 
-    T x = _x;
-
     //-----------------------------------------------------
-    // sinh(x) = (exp(x) - 1/exp(x))/2
-    // cosh(x) = (exp(x) + 1/exp(x))/2
-    //
-    // Currently, this appears more efficient than other techniques that don't use a LUT.
+    // Identities:
+    //     sinh(x) = (exp(x) - 1/exp(x))/2
+    //     cosh(x) = (exp(x) + 1/exp(x))/2
+    //     |x|     = i*log(2) + f                  i >= 0, f in 0 .. log(2)
+    //     exp(x)  = 2^i * (cosh(f) + sinh(f))
+    //     1/exp(x)= 2^-i * (cosh(f) - sinh(f))
+    // Strategy:
+    //     hyperbolic_rotation() with x0 = mantissa(r)/gain gives r*cosh(f) and r*sinh(f) in one pass.
+    //     For i == 0 those are the answers.  Otherwise scale their sum and difference by 2^(i-1) 
+    //     and 2^(-i-1) and add or subtract; no multiplies or divides either way.
+    //     With hyperbolic_neg_iter_set(), |x| within the extended range skips the reduction (i = 0, f = |x|).
+    //     Zero, infinite or NaN x or r go the long way through exp().
     //-----------------------------------------------------
-    T expx = exp( x, false );
-    T one_over_expx = div( _one, expx, false );
-    if ( _r != nullptr ) expx = mul( expx, *_r, false );
-    if ( need_sih ) {
-        sih = sub( expx, one_over_expx, false );
-        sih = scalbn( sih, -1, false );
-    }
-    if ( need_coh ) {
-        coh = add( expx, one_over_expx, false );
-        coh = scalbn( coh, -1, false );
+    T         x = _x;
+    T         x0;
+    int32_t   r_exp;
+    bool      r_sign;
+    const bool      x_sign      = signbit( _x );
+    const EXP_CLASS x_exp_class = classify( _x );
+    if ( (x_exp_class == EXP_CLASS::NORMAL || x_exp_class == EXP_CLASS::SUBNORMAL) &&
+         fold_r( _r, _hyperbolic_rotation_one_over_gain_fxd, x0, r_exp, r_sign ) ) {
+        if ( x_sign ) x = neg( x, false );
+        int32_t   i;
+        EXP_CLASS f_exp_class;
+        bool      f_sign;
+        if ( hyperbolic_neg_arg( x, _zero_fxd, x ) ) {
+            i           = 0;
+            f_exp_class = EXP_CLASS::NORMAL;
+        } else {
+            reduce_exp_arg( FLT(M_E), x, i, f_exp_class, f_sign );
+        }
+        T coh_f, sih_f, zz;
+        if ( f_exp_class == EXP_CLASS::ZERO ) {
+            coh_f = x0;
+            sih_f = 0;
+        } else {
+            hyperbolic_rotation( x0, _zero_fxd, x, coh_f, sih_f, zz );
+        }
+        if ( i == 0 ) {
+            sih = sih_f;
+            coh = coh_f;
+            reconstruct( sih, (sih == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, x_sign != r_sign );
+            reconstruct( coh, EXP_CLASS::NORMAL, r_exp, r_sign );
+        } else {
+            T ep = coh_f + sih_f;
+            T em = coh_f - sih_f;
+            reconstruct( ep, EXP_CLASS::NORMAL, r_exp + i - 1, r_sign );
+            reconstruct( em, EXP_CLASS::NORMAL, r_exp - i - 1, r_sign );
+            if ( need_sih ) {
+                sih = sub( ep, em, false );
+                if ( x_sign ) sih = neg( sih, false );
+            }
+            if ( need_coh ) coh = add( ep, em, false );
+        }
+
+    } else {
+        T expx = exp( x, false );
+        T one_over_expx = div( _one, expx, false );
+        if ( need_sih ) {
+            sih = sub( expx, one_over_expx, false );
+            sih = scalbn( sih, -1, false );
+            if ( _r != nullptr ) sih = mul( sih, *_r, false );
+        }
+        if ( need_coh ) {
+            coh = add( expx, one_over_expx, false );
+            coh = scalbn( coh, -1, false );
+            if ( _r != nullptr ) coh = mul( coh, *_r, false );
+        }
     }
 
     if ( is_final ) {
@@ -3951,9 +6946,12 @@ void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool n
     }
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::tanh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::tanh( const T& x ) const
 { 
+    _lookup_1( tanh, x );
+    _n_for_scope( tanh );
+    _memo_1( tanh, x, tanh( x ) );
     _log_1( tanh, x );
     T sih, coh;
     sinhcosh( x, sih, coh, false, true, true, nullptr );
@@ -3963,9 +6961,12 @@ T Cordic<T,FLT>::tanh( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::asinh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::asinh( const T& x ) const
 { 
+    _lookup_1( asinh, x );
+    _n_for_scope( asinh );
+    _memo_1( asinh, x, asinh( x ) );
     _log_1( asinh, x );
     T h = hypot( x, _one, false );
     T r = log( add( x, h, false ), false );
@@ -3974,9 +6975,12 @@ T Cordic<T,FLT>::asinh( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::acosh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::acosh( const T& x ) const
 { 
+    _lookup_1( acosh, x );
+    _n_for_scope( acosh );
+    _memo_1( acosh, x, acosh( x ) );
     _log_1( acosh, x );
     T hh = hypoth( x, _one, false );
     T r = log( add( x, hh, false ), false );
@@ -3985,24 +6989,28 @@ inline T Cordic<T,FLT>::acosh( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atanh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atanh( const T& x ) const
 { 
+    _lookup_1( atanh, x );
+    _n_for_scope( atanh );
+    _memo_1( atanh, x, atanh( x ) );
     T r = atanh2( x, _one, true, true );
     if ( debug ) std::cout << "atanh end: x_orig=" << _to_flt(x) << " atanh=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atanh2( const T& y, const T& x ) const             
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atanh2( const T& y, const T& x ) const             
 { 
+    _n_for_scope( atanh2 );
     T r = atanh2( y, x, true, false );
     if ( debug ) std::cout << "atanh2 end: y=" << _to_flt(y) << " x=" << _to_flt(x) << " atanh2=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one ) const             
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one, const T * atanh_tbl ) const             
 { 
     if ( debug ) std::cout << "atanh2 begin: y=" << _to_flt( _y ) << " x=" << _to_flt( _x ) << "\n";
 
@@ -4058,7 +7066,7 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
         exp = 0;
 
         T xx, yy;
-        hyperbolic_vectoring( x, y, _zero, xx, yy, r );
+        hyperbolic_vectoring( x, y, _zero, xx, yy, r, atanh_tbl );
         if ( r < 0 ) {
             r = -r;
             sign = !sign;
@@ -4072,8 +7080,8 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
     return r;
 }
 
-template< typename T, typename FLT >
-typename Cordic<T,FLT>::EXP_CLASS Cordic<T,FLT>::classify( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+typename Cordic<T,FLT,CORE>::EXP_CLASS Cordic<T,FLT,CORE>::classify( const T& _x ) const
 {
     T x = _x;
     EXP_CLASS x_exp_class;
@@ -4083,8 +7091,63 @@ typename Cordic<T,FLT>::EXP_CLASS Cordic<T,FLT>::classify( const T& _x ) const
     return x_exp_class;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& sign, bool allow_debug ) const
+template< typename T, typename FLT, typename CORE >
+inline int32_t Cordic<T,FLT,CORE>::msb( const T& x ) const
+{
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= sizeof( unsigned long long ) ) {
+        return int32_t( sizeof( unsigned long long )*8 - 1 ) - __builtin_clzll( static_cast<unsigned long long>( x ) );
+    } else {
+        // wider T: binary search over the format's width, starting at _w/2 rounded up to a power of 2
+        int32_t  p = 0;
+        T        v = x;
+        uint32_t s = 1;
+        while( 2*s < _t_w ) s <<= 1;
+        for( ; s != 0; s >>= 1 )
+        {
+            if ( (v >> s) != 0 ) {
+                v >>= s;
+                p += s;
+            }
+        }
+        return p;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rshift_sticky( const T& x, uint32_t s ) const
+{
+    //-----------------------------------------------------
+    // Same as doing x = (x >> 1) | (x & 1) s times.
+    //-----------------------------------------------------
+    if ( s == 0 ) return x;
+    if ( s >= (_t_w - 1) ) return T( x != 0 );
+    return (x >> s) | T( (x & ((T(1) << s) - 1)) != 0 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::to_int( const T& x ) const
+{
+    T         m = x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( m, x_exp_class, x_exp, x_sign, false );
+    if ( x_exp_class == EXP_CLASS::ZERO || x_exp < 0 ) return 0;
+    cassert( x_exp_class == EXP_CLASS::NORMAL, "to_int() x must be a finite number" );
+    const int32_t rs = int32_t(_frac_guard_w) - x_exp;
+    T r;
+    if ( rs >= 0 ) {
+        r = m >> rs;
+    } else if ( -rs < int32_t(sizeof( T )*8) ) {
+        r = m << -rs;
+    } else {
+        r = 0;
+    }
+    return x_sign ? -r : r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& sign, bool allow_debug ) const
 {
     T x_orig = x;
     if ( _is_float ) {
@@ -4098,8 +7161,10 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
         if ( exp_biased == 0 ) {
             if ( x == 0 ) {
                 x_exp_class = EXP_CLASS::ZERO;
+                x_exp       = 0;
             } else {
                 x_exp_class = EXP_CLASS::SUBNORMAL;     // FIXIT: probably best to normalize at this point
+                x_exp       = _exp_unbiased_min;        // same as add() uses for SUBNORMAL
             }
         } else if ( exp_biased == _exp_mask ) {
             if ( x == 0 ) {
@@ -4125,15 +7190,16 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
             sign = x < 0;
             if ( sign ) x = -x;
 
-            while( x > _one_fxd )
-            {
-                x_exp++;
-                x = (x >> 1) | (x & 1);    // must record sticky bit
+            if ( x > _one_fxd ) {
+                // smallest s such that x <= (1 << s), must record sticky bit
+                const int32_t s = msb( x ) - int32_t(_frac_guard_w) + int32_t( (x & (x - 1)) != 0 );
+                x_exp += s;
+                x = rshift_sticky( x, s );
             }
-            while( x < _one_fxd )
-            {
-                x_exp--;
-                x <<= 1;
+            const int32_t ls = int32_t(_frac_guard_w) - msb( x );
+            if ( ls > 0 ) {
+                x_exp -= ls;
+                x <<= ls;
             }
         }
     }
@@ -4143,8 +7209,8 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
                                              " sign=" << sign << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_exp, bool sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_exp, bool sign ) const
 {
     T x_orig = x;
     if ( debug ) std::cout << "reconstruct: x_orig=" << std::hex << x << std::dec << " x_orig_f=" << _to_flt(x, false, true) <<
@@ -4165,17 +7231,18 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
             case EXP_CLASS::NORMAL:
             case EXP_CLASS::SUBNORMAL:     
                 cassert( int_part != 0 || x != 0, "reconstruct() normal int_part or frac_part should be non-zero" );
-                while( int_part == 0 ) 
                 {
-                    int_part = (x >> (_frac_guard_w-1)) & 1;
-                    x = (x << 1) & _frac_guard_mask;
-                    x_exp--;
-                }
-                while( int_part > 1 ) 
-                {
-                    x = (x >> 1) | ((int_part&1) << (_frac_guard_w-1)) | (x & 1);
-                    int_part >>= 1;
-                    x_exp++;
+                    // normalize int_part:x so that int_part == 1, recording sticky bit on right shifts
+                    const int32_t p = msb( x_orig );
+                    T v = x_orig;
+                    if ( p < int32_t(_frac_guard_w) ) {
+                        v <<= _frac_guard_w - p;
+                    } else {
+                        v = rshift_sticky( v, p - _frac_guard_w );
+                    }
+                    x_exp   += p - int32_t(_frac_guard_w);
+                    int_part = v >> _frac_guard_w;
+                    x        = v & _frac_guard_mask;
                 }
                 cassert( int_part == 1, "reconstruct() normal int_part should be exactly 1, int=" + std::to_string(int_part) + 
                                         + " frac=" + std::to_string(x) + " x_orig=" + std::to_string(x_orig) );
@@ -4245,8 +7312,8 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
                               " x_exp_class=" + to_str(x_exp_class) << " x_exp=" << x_exp << " constructed_f=" << _to_flt(x, false) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const
 {
     if ( debug ) std::cout << "reduce_add_args: x_orig=" << _to_flt(x) << " y_orig=" << _to_flt(y) << "\n";
     deconstruct( x, x_exp_class, x_exp, x_sign );
@@ -4257,22 +7324,16 @@ inline void Cordic<T,FLT>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class,
    
     // rshift fraction with smaller exponent
     if ( x_exp > y_exp ) {
-        uint32_t rs = x_exp - y_exp;
-        bool set_sticky = (y & ((T(1) << rs)-1)) != 0;
-        y >>= rs;
-        if ( set_sticky ) y |= 1;
+        y = rshift_sticky( y, x_exp - y_exp );
         y_exp = x_exp;
     } else {
-        uint32_t rs = y_exp - x_exp;
-        bool set_sticky = (x & ((T(1) << rs)-1)) != 0;
-        x >>= rs;
-        if ( set_sticky ) x |= 1;
+        x = rshift_sticky( x, y_exp - x_exp );
         x_exp = y_exp;
     }
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const
 {
     if ( debug ) std::cout << "reduce_mul_div_args: is_mul=" << is_mul << " x_orig=" << _to_flt(x) << " y_orig=" << _to_flt(y) << "\n";
     bool x_sign;
@@ -4282,8 +7343,8 @@ inline void Cordic<T,FLT>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLA
     sign = x_sign ^ y_sign;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -4297,6 +7358,10 @@ inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_
     //-----------------------------------------------------
     T x_orig = x;
     deconstruct( x, x_exp_class, x_exp, x_sign );
+    if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+        normalize( x, x_exp );
+        x_exp_class = EXP_CLASS::NORMAL;
+    }
     if ( debug ) std::cout << "reduce_sqrt_arg mid: x=" << _to_flt(x, false) << " x_exp=" << x_exp << "\n";
     if ( x_exp_class == EXP_CLASS::NORMAL ) {
         x = (x >> 1) | (x & 1);
@@ -4312,8 +7377,8 @@ inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_
                               " x_exp_class=" << to_str(x_exp_class) << " x_exp=" << x_exp << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign, bool scaled ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -4326,6 +7391,7 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
     //     For exp2(i+f), choose i such at f is in -1..1.  Note that i can be negative.
     //     Multiply f by log(2) and return that as the returned x.
     //     And return i as the exp.
+    //     If scaled, return f itself for hyperbolic_rotation_scaled() with the base-2 table.
     //-----------------------------------------------------
     T x_orig = x;
     if ( debug ) std::cout << "reduce_exp_arg begin: b=" << b << " x_orig=" << _to_flt(x_orig) << "\n";
@@ -4336,8 +7402,10 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
         return;
     }
 
-    T log2_b = to_t( std::log2( b ), false );
-    x = mulc( x, log2_b, false );
+    const ConstMultiplier * log2_b = (b == FLT(M_E)) ? _log2_of_e_cm  :
+                                     (b == FLT(2))    ? _log2_of_2_cm  :
+                                     (b == FLT(10))   ? _log2_of_10_cm : nullptr;
+    if ( !scaled || b != FLT(2) ) x = (log2_b != nullptr) ? mulc( x, *log2_b, false ) : mulc( x, to_t( std::log2( b ), false ), false );
 
     // get integer and fraction parts, still encoded;
     // convert encoded ii to int32_t;
@@ -4349,18 +7417,19 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
         f  = add( f,  _one, false );
     }
     if ( debug ) std::cout << "reduce_exp_arg mid1: x=" << _to_flt(x) << " f=" << _to_flt(f) << " ii=" << _to_flt(ii) << "\n";
-    i = _to_flt( ii );
-    x = mulc( f, _log2, false );
-    if ( debug ) std::cout << "reduce_exp_arg mid2: f*log2=" << _to_flt(x) << "\n";
+    const T ii_int = to_int( ii );
+    cassert( ii_int >= T(INT32_MIN) && ii_int <= T(INT32_MAX), "reduce_exp_arg() integer part does not fit in int32_t" );
+    i = int32_t( ii_int );
+    x = scaled ? f : mulc( f, *_log2_cm, false );
+    if ( debug ) std::cout << "reduce_exp_arg mid2: f*log2=" << _to_flt(x) << " scaled=" << scaled << "\n";
 
     int32_t x_exp;
     deconstruct( x, x_exp_class, x_exp, x_sign );
-    while ( x_exp < 0 ) 
-    {
-        // turn back into un-normalized fraction (shouldn't need to shift much)
+    if ( x_exp < 0 ) {
+        // turn back into un-normalized fraction
         //
-        x = (x >> 1) | (x & 1);
-        x_exp++;
+        x = rshift_sticky( x, -x_exp );
+        x_exp = 0;
     }
 
     if ( debug ) std::cout << "reduce_exp_arg end: b=" << b << " x_orig=" << _to_flt(x_orig) << 
@@ -4368,8 +7437,8 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
                               " x_reduced=log(2)*f=" << _to_flt(x, false, true) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend, FLT b ) const
 {
     //-----------------------------------------------------
     // log(x*y)         = log(x) + log(y)
@@ -4377,7 +7446,7 @@ inline void Cordic<T,FLT>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x
     // log(2^i + f)     = i*log(2) + log(f)                     i=integer f=remainder
     // 
     // Normalize x so that it's in 1.00 .. 2.00.
-    // Then addend = i*log(2).
+    // Then addend = i*log(2), or i*log_b(2) for b=2 and b=10.
     //-----------------------------------------------------
     T x_orig = x;
     int32_t x_exp;
@@ -4389,15 +7458,18 @@ inline void Cordic<T,FLT>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x
         x = (x >> 1) | (x & 1);
         if ( debug ) std::cout << "reduce_log_mid: x_shifted=0x" << std::hex << x << std::dec << "\n";
     }
-    addend = to_t( FLT(x_exp) * std::log(2) );
+    cassert( x_exp >= _exp_times_log2_min, "reduce_log_arg() x_exp is below _exp_times_log2[]" );
+    const T * addends = (b == FLT(2))  ? _exp_times_log2_b2  :
+                        (b == FLT(10)) ? _exp_times_log2_b10 : _exp_times_log2;
+    addend = addends[x_exp - _exp_times_log2_min];
     reconstruct( x, x_exp_class, 0, false );
     if ( debug ) std::cout << "reduce_log_arg: x_orig=" << _to_flt(x_orig) << " x_reduced=" << _to_flt(x, false) <<
                                              " (0x" << std::hex << x << ")" << std::dec <<
                                              " addend=" << _to_flt(addend, false) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const
 {
     //-----------------------------------------------------
     // Must shift both x and y by max( x_exp, y_exp ).
@@ -4487,8 +7559,8 @@ inline void Cordic<T,FLT>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class,
     }
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& quad, EXP_CLASS& exp_class, bool& sign, bool& did_minus_pi_div_4 ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& quad, EXP_CLASS& exp_class, bool& sign ) const
 {
     //-----------------------------------------------------
     // Quick check for special values.
@@ -4516,54 +7588,201 @@ inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& qua
             //-----------------------------------------------------
             // Normal or Subnormal
             //
-            // Compute a * 4/PI, then take integer part of that.
-            // Subtract int_part*PI/4 from a.
-            // If we ended up subtracting an odd PI/4, then set the flag.
+            // Round a * 2/PI to the nearest integer i (for times_pi, a * 2).
+            // Subtract i*PI/2 from a, which leaves a in -PI/4 .. PI/4.
+            // The quadrant is i mod 4.  The returned a is signed fixed-point.
+            //
+            // Payne-Hanek handles large exponents, reduce_sincos_arg_fxd() the rest.
+            // Between them they cover every exponent of a 64-bit T format except
+            // the top of 12+ bit exponent ranges, which is beyond our 2/PI bits.
             //-----------------------------------------------------
             exp_class = EXP_CLASS::NORMAL;
             const T a_orig = a;
             sign = signbit( a );
             if ( sign ) a = neg( a, false );
-            T m;
-            T aa = 0;
-            T i;
-            if ( !times_pi ) {
-                m = mulc( a, _four_div_pi, false );
-                (void)modf( m, &i );
-                aa = mulc( i, _pi_div_4, false );
-                a = sub( a, aa, false );
-                if ( debug ) std::cout << "reduce_sincos_arg mid: a_orig=" << _to_flt(a_orig) <<
-                                          " aa_f=" << _to_flt(aa) << " aa=0x" << std::hex << aa << std::dec << 
-                                          " a_reduced_f=" << _to_flt(a) << " a_reduced=0x" << std::hex << a << std::dec << "\n";
-            } else {
-                m = scalbn( a, -2, false );  // divide by 4
-                m = modf( m, &i );
-                a = mulc( m, _four_div_pi, false );
-            }
-            EXP_CLASS a_exp_class;
-            int32_t   a_exp;
-            bool      a_sign;
-            deconstruct( a, a_exp_class, a_exp, a_sign );
-            while( a_exp < 0 ) 
-            {
-                a = (a >> 1) | (a & 1);
-                a_exp++;
+            if ( !times_pi && ilogb( a ) >= _payne_hanek_exp_min && reduce_sincos_arg_payne_hanek( a, quad ) ) {
+                if ( debug ) std::cout << "reduce_sincos_arg payne_hanek: a_orig=" << _to_flt(a_orig) << 
+                                          " a_reduced=" << _to_flt(a, false, true) << " quadrant=" << quad << "\n"; 
+                break;
             }
-
-            T ii = _to_flt( i ); 
-            quad = (ii >> 1) & 3;
-            did_minus_pi_div_4 = ii & 1;
-
+            T         a_mant = a;
+            EXP_CLASS a_mant_class;
+            int32_t   a_mant_exp;
+            bool      a_mant_sign;
+            deconstruct( a_mant, a_mant_class, a_mant_exp, a_mant_sign );
+            const bool reduced = reduce_sincos_arg_fxd( times_pi, a_mant, a_mant_exp, a, quad );
+            cassert( reduced, "reduce_sincos_arg: a=" + to_string( a_orig ) + " is beyond the 2/PI bits we have" );
             if ( debug ) std::cout << "reduce_sincos_arg: times_pi=" << times_pi << " a_orig=" << _to_flt(a_orig) << 
-                                      " m=" << _to_flt(m) << " aa=" << _to_flt(aa) << " i=" << _to_flt(i) << " ii=" << ii <<
-                                      " a_reduced=" << _to_flt(a, false, true) << " a_exp_class=" << to_str(a_exp_class) << 
-                                      " a_exp=" << a_exp << " a_sign=" << a_sign << " quadrant=" << quad << " did_minus_pi_div_4=" << did_minus_pi_div_4 << "\n"; 
+                                      " a_reduced=" << _to_flt(a, false, true) << " quadrant=" << quad << "\n"; 
 
             break;
         }
     }
 }
 
+//-----------------------------------------------------
+// 2/PI to 1536 bits, most-significant bit first: bit k of the string is the 2^(-k) bit.
+//-----------------------------------------------------
+static constexpr uint64_t cordic_two_div_pi_words[] = 
+{
+    0xA2F9836E4E441529ULL, 0xFC2757D1F534DDC0ULL, 0xDB6295993C439041ULL, 0xFE5163ABDEBBC561ULL,
+    0xB7246E3A424DD2E0ULL, 0x06492EEA09D1921CULL, 0xFE1DEB1CB129A73EULL, 0xE88235F52EBB4484ULL,
+    0xE99C7026B45F7E41ULL, 0x3991D639835339F4ULL, 0x9C845F8BBDF9283BULL, 0x1FF897FFDE05980FULL,
+    0xEF2F118B5A0A6D1FULL, 0x6D367ECF27CB09B7ULL, 0x4F463F669E5FEA2DULL, 0x7527BAC7EBE5F17BULL,
+    0x3D0739F78A5292EAULL, 0x6BFB5FB11F8D5D08ULL, 0x56033046FC7B6BABULL, 0xF0CFBC209AF4361DULL,
+    0xA9E391615EE61B08ULL, 0x6599855F14A06840ULL, 0x8DFFD8804D732731ULL, 0x06061556CA73A8C9ULL,
+};
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::reduce_sincos_arg_payne_hanek( T& a, uint32_t& quadrant ) const
+{
+    //-----------------------------------------------------
+    // Payne-Hanek:
+    //     a = M * 2^q     where M is the fixed-point mantissa as an integer and q = exp - frac_guard_w
+    //     a * 4/PI = M * 2^(q+1) * sum( b[k] * 2^(-k) )     b[k] = bit k of 2/PI
+    //
+    // Only i = int(a*4/PI) mod 8 and the fraction are needed, so bits k < q-1 can be
+    // skipped (they contribute multiples of 8), and bits past q+1+FB contribute less than 
+    // 2^(frac_guard_w+1-FB).  With FB = 2*frac_guard_w+8 that is well below one lsb.
+    // The window W of bits k=q-1..q+1+FB is multiplied by M using shifts and adds only,
+    // keeping the low FB+3 bits.  Then a_reduced = fraction * PI/4, again with shifts and adds,
+    // after odd octants are rounded up to the next quadrant so that a_reduced is in -PI/4 .. PI/4.
+    //-----------------------------------------------------
+    __extension__ typedef unsigned __int128 U2;
+    static constexpr uint32_t WORD_CNT = sizeof( cordic_two_div_pi_words ) / sizeof( cordic_two_div_pi_words[0] );
+
+    EXP_CLASS a_exp_class;
+    int32_t   a_exp;
+    bool      a_sign;
+    T         mant = a;
+    deconstruct( mant, a_exp_class, a_exp, a_sign );
+    if ( a_exp_class != EXP_CLASS::NORMAL ) return false;
+
+    const uint32_t FB     = 2*_frac_guard_w + 8;
+    const uint32_t width  = FB + 3;
+    if ( width > 128 ) return false;
+    const int32_t  q      = a_exp - int32_t(_frac_guard_w);
+    const int32_t  k_lo   = (q > 2) ? (q - 1) : 1;
+    const int32_t  k_hi   = q + 1 + int32_t(FB);
+    if ( k_hi < k_lo || k_hi > int32_t(64*(WORD_CNT-2)) ) return false;
+
+    // W = bits k_lo..k_hi of 2/PI 
+    const uint32_t b0     = k_lo - 1;
+    const uint32_t w0     = b0 / 64;
+    const uint32_t sh     = b0 % 64;
+    U2 top = (U2( cordic_two_div_pi_words[w0] ) << 64) | U2( cordic_two_div_pi_words[w0+1] );
+    if ( sh != 0 ) top = (top << sh) | U2( cordic_two_div_pi_words[w0+2] >> (64 - sh) );
+    const U2 W = top >> (128 - (k_hi - k_lo + 1));
+
+    // P = M * W  mod 2^width
+    const U2 width_mask = (width == 128) ? ~U2(0) : ((U2(1) << width) - 1);
+    U2 P = 0;
+    for( uint32_t j = 0; mant != 0; j++, mant >>= 1 )
+    {
+        if ( (mant & 1) != 0 ) P += W << j;
+    }
+    P &= width_mask;
+
+    // octant i = int(a*4/PI) mod 8 and fraction f; an odd octant rounds up to the next quadrant, leaving f-1 
+    const uint32_t i = uint32_t( P >> FB ) & 7;
+    U2 f = (P & ((U2(1) << FB) - 1)) >> (FB - _frac_guard_w);          // fraction with frac_guard_w bits
+    const bool is_neg = (i & 1) != 0;
+    if ( is_neg ) f = (U2(1) << _frac_guard_w) - f;
+    quadrant = ((i + 1) >> 1) & 3;
+
+    // a = f * PI/4
+    U2 prod = 0;
+    U2 pi4  = U2( _pi_div_4_fxd );
+    for( ; f != 0; f >>= 1, pi4 <<= 1 )
+    {
+        if ( (f & 1) != 0 ) prod += pi4;
+    }
+    a = T( prod >> _frac_guard_w );
+    if ( is_neg ) a = -a;
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::reduce_sincos_arg_fxd( bool times_pi, const T& m, int32_t e, T& a, uint32_t& quadrant ) const
+{
+    //-----------------------------------------------------
+    // a = m * 2^(e-F), F = frac_guard_w, m in [2^F, 2^(F+1)).
+    // Plain integer arithmetic with 64-bit 2/PI and PI/2, no encoded ops:
+    //
+    //     j  = round(a * 2/PI)                    (times_pi: round(2*a))
+    //     r  = a - j*PI/2                         (times_pi: (2*a - j) * PI/2)
+    //
+    // r is formed with 62 fraction bits, then shifted down to F with a sticky lsb like
+    // the other reductions.  The 2/PI truncation can only move j across a .5 tie, which
+    // leaves |r| a hair over PI/4, well inside circular_angle_max.
+    // For !times_pi, larger exponents are left to Payne-Hanek.
+    // For times_pi, 2*a is an integer once e >= F-1, so r is exactly 0.
+    //-----------------------------------------------------
+    __extension__ typedef unsigned __int128 U2;
+    __extension__ typedef __int128          I2;
+    static constexpr uint64_t TWO_DIV_PI_64 = 0xA2F9836E4E441529ULL;   // 2/PI * 2^64, same as cordic_two_div_pi_words[0]
+    static constexpr int64_t  PI_DIV_2_62   = 0x6487ED5110B4611ALL;    // PI/2 * 2^62 rounded
+    const int32_t F = int32_t(_frac_guard_w);
+    if ( F > 62 || (!times_pi && e > 40) ) return false;
+
+    auto rshift_sticky2 = []( U2 v, int32_t s ) -> U2 { return (s <= 0) ? v : (s >= 127) ? U2( v != 0 ) : ((v >> s) | U2( (v & ((U2(1) << s) - 1)) != 0 )); };
+    I2 r;                                                               // r * 2^62 for !times_pi
+    int32_t r_shift;                                                    // r_fxd = r >> r_shift
+    U2 j;
+    if ( !times_pi ) {
+        const U2      p = U2( uint64_t( m ) ) * TWO_DIV_PI_64;          // a * 2/PI * 2^(64+F-e)
+        const int32_t s = F + 64 - e;
+        j = (s >= 127) ? U2( 0 ) : ((p + (U2( 1 ) << (s-1))) >> s);
+        const int32_t t = e - F + 62;                                   // a * 2^62 = m << t
+        const U2      a62 = (t >= 0) ? (U2( uint64_t( m ) ) << t) : rshift_sticky2( U2( uint64_t( m ) ), -t );
+        r = I2( a62 ) - I2( j ) * PI_DIV_2_62;
+        r_shift = 62 - F;
+    } else {
+        const int32_t s = F - e - 1;                                    // 2*a = m * 2^-s
+        if ( s <= 0 ) {
+            // 2*a is an integer, so r = 0
+            j = (s <= -2) ? U2( 0 ) : U2( uint64_t( m ) << -s );
+            r = 0;
+        } else {
+            j = (s >= 127) ? U2( 0 ) : ((U2( uint64_t( m ) ) + (U2( 1 ) << (s-1))) >> s);
+            r = (I2( uint64_t( m ) ) - (I2( j ) << ((s >= 127) ? 0 : s))) * PI_DIV_2_62;  // (2*a - j) * PI/2 * 2^(62+s)
+        }
+        r_shift = 62 + s - F;
+    }
+    const bool r_neg = r < 0;
+    const T    r_fxd = T( rshift_sticky2( U2( r_neg ? -r : r ), r_shift ) );
+    a = r_neg ? -r_fxd : r_fxd;
+    quadrant = uint32_t( j ) & 3;
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::reconstruct_round( const T& v, int32_t exp, bool sign, bool is_final ) const
+{
+    //-----------------------------------------------------
+    // For floating-point results in the normal range (the usual case), the encoding 
+    // is packed directly and the guard bits are rounded in place.  A carry out of 
+    // the fraction bumps the exponent field, which is what reconstruct() does with 
+    // the rounded-up mantissa.  Anything else goes through reconstruct() and rfrac().
+    //-----------------------------------------------------
+    const int32_t F = int32_t(_frac_guard_w);
+    const int32_t p = (v > 0) ? msb( v ) : 0;
+    const int32_t biased = exp + p - F + int32_t(_exp_bias);
+    if ( !_is_float || v <= 0 || biased < 1 || biased >= int32_t(_exp_mask) - 1 ) {
+        T r = v;
+        reconstruct( r, (v == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, exp, sign );
+        return is_final ? rfrac( r ) : r;
+    }
+
+    const T m = (p <= F) ? (v << (F - p)) : rshift_sticky( v, p - F );
+    T r = (T(sign) << (_w-1)) | (T(biased) << F) | (m & _frac_guard_mask);
+    const T guard = r & _guard_mask;
+    if ( !is_final || guard == 0 || _rounding_mode == FE_NOROUND ) return r;
+
+    r &= ~_guard_mask;
+    return rfrac_up( guard, sign, _rounding_mode ) ? (r + _min_fxd) : r;
+}
+
 template class Cordic<int64_t, double>;
 
 #endif
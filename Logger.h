@@ -26,6 +26,8 @@
 #include <string>
 #include <cmath>
 #include <iostream>
+#include <cstdio>
+#include <atomic>
 
 #ifdef NO_FMT_LL
 #define FMT_LLU "lu"
@@ -70,10 +72,31 @@ public:
     virtual void op3( uint16_t op, const T *  opnd1, const T *  opnd2, const T * opnd3 );
     virtual void op4( uint16_t op, const T *  opnd1, const T *  opnd2, const T * opnd3, const T * opnd4 );
 
+    // log CORDIC iterations that a core routine did not have to do (early exit, small-angle skip);
+    // the core routines can run on any thread, so the count is atomic
+    virtual void iterations_skipped( const void * cordic, uint32_t cnt );
+    uint64_t     iterations_skipped_cnt( void ) const;
+
+    // log memo cache lookups (see Cordic::memo_cache_set());
+    // lookups can come from any thread, so the counts are atomic
+    virtual void memo_lookup( const void * cordic, uint16_t op, bool hit );
+    uint64_t     memo_hit_cnt( void ) const;
+    uint64_t     memo_miss_cnt( void ) const;
+
+    // print the skipped-iteration and memo counts for the Analysis print_stats() routines
+    void         print_counts( FILE * out_file, std::ostream& csv ) const;
+
+protected:
+    void         iterations_skipped_count( uint32_t cnt );       // count only, no record
+    void         memo_lookup_count( bool hit );                  // count only, no record
+
 private:
     op_to_str_fn_t      op_to_str;
     std::ostream *      out;
     bool                out_text;
+    std::atomic<uint64_t> skipped_cnt;
+    std::atomic<uint64_t> hit_cnt;
+    std::atomic<uint64_t> miss_cnt;
 };
 
 //-----------------------------------------------------
@@ -101,6 +124,9 @@ Logger<T,FLT>::Logger( op_to_str_fn_t _op_to_str,
 {
     op_to_str = _op_to_str;
     out_text  = file_name == "";
+    skipped_cnt = 0;
+    hit_cnt     = 0;
+    miss_cnt    = 0;
     if ( out_text ) {
         out = &std::cout;
     }
@@ -233,4 +259,80 @@ inline void Logger<T,FLT>::op4( uint16_t op, const T * opnd1, const T * opnd2, c
     }
 }
 
+template< typename T, typename FLT >
+inline void Logger<T,FLT>::iterations_skipped( const void * cordic, uint32_t cnt )
+{
+    iterations_skipped_count( cnt );
+    if ( out_text ) {
+        *out << "iterations_skipped( " << cordic << ", " << std::dec << cnt << " )\n";
+    }
+}
+
+template< typename T, typename FLT >
+inline void Logger<T,FLT>::iterations_skipped_count( uint32_t cnt )
+{
+    skipped_cnt.fetch_add( cnt, std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT >
+inline uint64_t Logger<T,FLT>::iterations_skipped_cnt( void ) const
+{
+    return skipped_cnt.load( std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT >
+inline void Logger<T,FLT>::memo_lookup( const void * cordic, uint16_t op, bool hit )
+{
+    memo_lookup_count( hit );
+    if ( out_text ) {
+        *out << "memo_lookup( " << cordic << ", " << op_to_str( op ) << ", " << (hit ? 1 : 0) << " )\n";
+    }
+}
+
+template< typename T, typename FLT >
+inline void Logger<T,FLT>::memo_lookup_count( bool hit )
+{
+    if ( hit ) {
+        hit_cnt.fetch_add( 1, std::memory_order_relaxed );
+    } else {
+        miss_cnt.fetch_add( 1, std::memory_order_relaxed );
+    }
+}
+
+template< typename T, typename FLT >
+inline uint64_t Logger<T,FLT>::memo_hit_cnt( void ) const
+{
+    return hit_cnt.load( std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT >
+inline uint64_t Logger<T,FLT>::memo_miss_cnt( void ) const
+{
+    return miss_cnt.load( std::memory_order_relaxed );
+}
+
+template< typename T, typename FLT >
+void Logger<T,FLT>::print_counts( FILE * out_file, std::ostream& csv ) const
+{
+    const uint64_t memo_cnt = memo_hit_cnt() + memo_miss_cnt();
+    if ( memo_cnt != 0 ) {
+        const double hit_rate = double(memo_hit_cnt()) / double(memo_cnt);
+        fprintf( out_file, "\n\nMemo Cache:\n" );
+        fprintf( out_file, "    %-40s:  %10" FMT_LLU "\n", "hits",   memo_hit_cnt() );
+        fprintf( out_file, "    %-40s:  %10" FMT_LLU "\n", "misses", memo_miss_cnt() );
+        fprintf( out_file, "    %-40s:  %10.4f\n", "hit rate", hit_rate );
+        csv << "\n\n\"Memo Cache:\"\n";
+        csv << "\"hits\", " << memo_hit_cnt() << "\n";
+        csv << "\"misses\", " << memo_miss_cnt() << "\n";
+        csv << "\"hit rate\", " << hit_rate << "\n";
+    }
+
+    if ( iterations_skipped_cnt() != 0 ) {
+        fprintf( out_file, "\n\nCORDIC Iterations Skipped:\n" );
+        fprintf( out_file, "    %-40s:  %10" FMT_LLU "\n", "total", iterations_skipped_cnt() );
+        csv << "\n\n\"CORDIC Iterations Skipped:\"\n";
+        csv << "\"total\", " << iterations_skipped_cnt() << "\n";
+    }
+}
+
 #endif
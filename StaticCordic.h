@@ -0,0 +1,567 @@
+// Copyright (c) 2014-2019 Robert A. Alfieri
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+// StaticCordic.h - Cordic whose format is fixed at compile time
+//
+// The number format and iteration count are template parameters, so the atan/atanh 
+// tables are constexpr arrays and the core CORDIC loops are fully unrolled with 
+// constant shift amounts and constant table entries.  Everything else (argument 
+// reduction, rounding, the math functions) is inherited from Cordic<T,FLT,StaticCordic>,
+// whose core routines call the unrolled ones here directly (CRTP, no virtual calls).
+//
+// Results are bit-identical to a Cordic constructed with the same parameters.
+// Only the classic radix-2 loops are unrolled; with any Cordic mode set, the Cordic versions are used.
+// Because the base is a different Cordic instantiation, it has its own logger_set() and 
+// cannot be used as the Cordic of an freal.
+// T must be a literal integer type such as int64_t.
+//
+#ifndef _StaticCordic_h
+#define _StaticCordic_h
+
+#include <array>
+#include <utility>
+
+#include "Cordic.h"
+
+// default guard_w is ceil(log2(frac_w)), same as Cordic constructor
+//
+static constexpr uint32_t static_cordic_guard_w( uint32_t frac_w )
+{
+    uint32_t w = 0;
+    while( (uint32_t(1) << w) < frac_w ) w++;
+    return w;
+}
+
+template< typename T, uint32_t INT_EXP_W, uint32_t FRAC_W, bool IS_FLOAT=true, 
+          uint32_t GUARD_W=static_cordic_guard_w( FRAC_W ), uint32_t N=FRAC_W+1, typename FLT=double >
+class StaticCordic : public Cordic<T,FLT,StaticCordic<T,INT_EXP_W,FRAC_W,IS_FLOAT,GUARD_W,N,FLT>>
+{
+public:
+    StaticCordic( void );
+    ~StaticCordic();
+
+private:
+    friend class Cordic<T,FLT,StaticCordic>;
+
+    //-----------------------------------------------------
+    // Unrolled versions of the basic CORDIC functions.
+    // Cordic calls these only when its modes are at their defaults.
+    // See Cordic.h for the input and output ranges.
+    //-----------------------------------------------------
+    void circular_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void circular_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void circular_vectoring_xy_unrolled( const T& x0, const T& y0, T& x, T& y ) const;
+    void hyperbolic_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void hyperbolic_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void hyperbolic_vectoring_xy_unrolled( const T& x0, const T& y0, T& x, T& y ) const;
+    void linear_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    void linear_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+
+    static_assert( (1+INT_EXP_W+FRAC_W+GUARD_W) <= (sizeof( T ) * 8), "1 + INT_EXP_W + FRAC_W + GUARD_W does not fit in T container" );
+    static_assert( INT_EXP_W != 0, "INT_EXP_W must be > 0" );
+    static_assert( FRAC_W    != 0, "FRAC_W must be > 0" );
+
+    static constexpr uint32_t   FRAC_GUARD_W = FRAC_W + GUARD_W;
+    static constexpr T          ONE          = T(1) << FRAC_GUARD_W;
+    static constexpr T          MIN          = T(1) << GUARD_W;
+
+    using Cordic<T,FLT,StaticCordic>::cneg;
+
+    //-----------------------------------------------------
+    // constexpr versions of what the Cordic constructor computes with std::atan() and std::atanh().
+    // The series are summed in long double, then the value is rounded to FLT and then 
+    // to fixed-point the same way as to_t( a, false, true ).
+    //-----------------------------------------------------
+    static constexpr long double atan_series( long double x )          // |x| <= 1/2
+    {
+        long double sum  = 0;
+        long double term = x;
+        for( uint32_t k = 0; ; k++, term *= x*x )
+        {
+            const long double sum_new = sum + ((k & 1) ? (-term / (2*k+1)) : (term / (2*k+1)));
+            if ( sum_new == sum ) break;
+            sum = sum_new;
+        }
+        return sum;
+    }
+
+    static constexpr long double atanh_series( long double x )         // |x| <= 1/2
+    {
+        long double sum  = 0;
+        long double term = x;
+        for( uint32_t k = 0; ; k++, term *= x*x )
+        {
+            const long double sum_new = sum + term / (2*k+1);
+            if ( sum_new == sum ) break;
+            sum = sum_new;
+        }
+        return sum;
+    }
+
+    static constexpr T to_fxd( long double a )
+    {
+        const bool sign = a < 0;
+        const FLT  x_f  = FLT( sign ? -a : a ) * FLT( ONE );
+        T          x_t  = T( x_f );
+        if ( (x_f - FLT( x_t )) >= FLT( 0.5 ) ) x_t++;                // round half away from 0, like std::round()
+        return sign ? -x_t : x_t;
+    }
+
+    static constexpr std::array<T, N+1> make_atan_table( void )
+    {
+        std::array<T, N+1> t {};
+        long double pow2 = 1.0;
+        for( uint32_t i = 0; i <= N; i++, pow2 /= 2 )
+        {
+            // atan(1) = PI/4 = 4*atan(1/5) - atan(1/239)   (Machin)
+            t[i] = to_fxd( (i == 0) ? (4*atan_series( 1.0L/5 ) - atan_series( 1.0L/239 )) : atan_series( pow2 ) );
+        }
+        return t;
+    }
+
+    static constexpr std::array<T, N+1> make_atanh_table( void )
+    {
+        std::array<T, N+1> t {};
+        long double pow2 = 1.0;
+        for( uint32_t i = 0; i <= N; i++, pow2 /= 2 )
+        {
+            t[i] = (i == 0) ? to_fxd( -1 ) : to_fxd( atanh_series( pow2 ) );
+        }
+        return t;
+    }
+
+    // hyperbolic iterations are 1 .. N with 4, 13, 40, 121, ..., 3*i+1 done twice
+    //
+    static constexpr uint32_t hyperbolic_step_cnt( void )
+    {
+        uint32_t cnt = 0;
+        uint32_t next_dup_i = 4;
+        for( uint32_t i = 1; i <= N; i++ )
+        {
+            cnt++;
+            if ( i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                cnt++;
+            }
+        }
+        return cnt;
+    }
+
+    static constexpr uint32_t HYPERBOLIC_STEP_CNT = hyperbolic_step_cnt();
+
+    static constexpr std::array<uint32_t, HYPERBOLIC_STEP_CNT> make_hyperbolic_schedule( void )
+    {
+        std::array<uint32_t, HYPERBOLIC_STEP_CNT> s {};
+        uint32_t k = 0;
+        uint32_t next_dup_i = 4;
+        for( uint32_t i = 1; i <= N; i++ )
+        {
+            s[k++] = i;
+            if ( i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                s[k++] = i;
+            }
+        }
+        return s;
+    }
+
+    static constexpr std::array<T,        N+1>                 _atan_fxd            = make_atan_table();
+    static constexpr std::array<T,        N+1>                 _atanh_fxd           = make_atanh_table();
+    static constexpr std::array<uint32_t, HYPERBOLIC_STEP_CNT> _hyperbolic_schedule = make_hyperbolic_schedule();
+
+    static constexpr T sum_hyperbolic_angles( void )
+    {
+        T sum = 0;
+        for( uint32_t k = 0; k < HYPERBOLIC_STEP_CNT; k++ ) sum += _atanh_fxd[_hyperbolic_schedule[k]];
+        return sum;
+    }
+
+    static constexpr T CIRCULAR_ANGLE_MAX   = _atan_fxd[0] + 2*MIN;                 // PI/4
+    static constexpr T HYPERBOLIC_ANGLE_MAX = sum_hyperbolic_angles() + 2*MIN;      // 1.1182...
+
+    //-----------------------------------------------------
+    // One micro-rotation.  I is the iteration (shift amount), 
+    // S is the step index into _hyperbolic_schedule.
+    //-----------------------------------------------------
+    template< uint32_t I > static void circular_rotation_step(       T& x, T& y, T& z );
+    template< uint32_t I > static void circular_vectoring_step(      T& x, T& y, T& z );
+    template< uint32_t I > static void circular_vectoring_xy_step(   T& x, T& y );
+    template< uint32_t S > static void hyperbolic_rotation_step(     T& x, T& y, T& z );
+    template< uint32_t S > static void hyperbolic_vectoring_step(    T& x, T& y, T& z );
+    template< uint32_t S > static void hyperbolic_vectoring_xy_step( T& x, T& y );
+    template< uint32_t I > static void linear_rotation_step(         T& x, T& y, T& z );
+    template< uint32_t I > static void linear_vectoring_step(        T& x, T& y, T& z );
+
+    template< size_t... I > static void circular_rotation_steps(       T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void circular_vectoring_steps(      T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void circular_vectoring_xy_steps(   T& x, T& y,       std::index_sequence<I...> );
+    template< size_t... S > static void hyperbolic_rotation_steps(     T& x, T& y, T& z, std::index_sequence<S...> );
+    template< size_t... S > static void hyperbolic_vectoring_steps(    T& x, T& y, T& z, std::index_sequence<S...> );
+    template< size_t... S > static void hyperbolic_vectoring_xy_steps( T& x, T& y,       std::index_sequence<S...> );
+    template< size_t... I > static void linear_rotation_steps(         T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void linear_vectoring_steps(        T& x, T& y, T& z, std::index_sequence<I...> );
+};
+
+//-----------------------------------------------------
+// Constructor
+//-----------------------------------------------------
+#define _SC_TEMPLATE template< typename T, uint32_t INT_EXP_W, uint32_t FRAC_W, bool IS_FLOAT, uint32_t GUARD_W, uint32_t N, typename FLT >
+#define _SC StaticCordic<T,INT_EXP_W,FRAC_W,IS_FLOAT,GUARD_W,N,FLT>
+
+_SC_TEMPLATE
+_SC::StaticCordic( void ) 
+    : Cordic<T,FLT,StaticCordic>( INT_EXP_W, FRAC_W, IS_FLOAT, GUARD_W, N )
+{
+}
+
+_SC_TEMPLATE
+_SC::~StaticCordic()
+{
+}
+
+//-----------------------------------------------------
+// Single Steps
+//-----------------------------------------------------
+_SC_TEMPLATE
+template< uint32_t I > 
+inline void _SC::circular_rotation_step( T& x, T& y, T& z )
+{
+    constexpr T A = _atan_fxd[I];
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(z < 0);
+        x -= cneg( ys, m );
+        y += cneg( xs, m );
+        z -= cneg( A, m );
+    } else if ( z >= 0 ) {
+        x -= ys;
+        y += xs;
+        z -= A;
+    } else {
+        x += ys;
+        y -= xs;
+        z += A;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t I > 
+inline void _SC::circular_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr T A = _atan_fxd[I];
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(y >= 0);
+        x -= cneg( ys, m );
+        y += cneg( xs, m );
+        z -= cneg( A, m );
+    } else if ( y < 0 ) {
+        x -= ys;
+        y += xs;
+        z -= A;
+    } else {
+        x += ys;
+        y -= xs;
+        z += A;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t I > 
+inline void _SC::circular_vectoring_xy_step( T& x, T& y )
+{
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(y >= 0);
+        x -= cneg( ys, m );
+        y += cneg( xs, m );
+    } else if ( y < 0 ) {
+        x -= ys;
+        y += xs;
+    } else {
+        x += ys;
+        y -= xs;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t S > 
+inline void _SC::hyperbolic_rotation_step( T& x, T& y, T& z )
+{
+    constexpr uint32_t I = _hyperbolic_schedule[S];
+    constexpr T        A = _atanh_fxd[I];
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(z < 0);
+        x += cneg( ys, m );
+        y += cneg( xs, m );
+        z -= cneg( A, m );
+    } else if ( z >= 0 ) {
+        x += ys;
+        y += xs;
+        z -= A;
+    } else {
+        x -= ys;
+        y -= xs;
+        z += A;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t S > 
+inline void _SC::hyperbolic_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr uint32_t I = _hyperbolic_schedule[S];
+    constexpr T        A = _atanh_fxd[I];
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(y >= 0);
+        x += cneg( ys, m );
+        y += cneg( xs, m );
+        z -= cneg( A, m );
+    } else if ( y < 0 ) {
+        x += ys;
+        y += xs;
+        z -= A;
+    } else {
+        x -= ys;
+        y -= xs;
+        z += A;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t S > 
+inline void _SC::hyperbolic_vectoring_xy_step( T& x, T& y )
+{
+    constexpr uint32_t I = _hyperbolic_schedule[S];
+    const T xs = x >> I;
+    const T ys = y >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(y >= 0);
+        x += cneg( ys, m );
+        y += cneg( xs, m );
+    } else if ( y < 0 ) {
+        x += ys;
+        y += xs;
+    } else {
+        x -= ys;
+        y -= xs;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t I > 
+inline void _SC::linear_rotation_step( T& x, T& y, T& z )
+{
+    constexpr T POW2 = ONE >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(z < 0);
+        y += cneg( x >> I, m );
+        z -= cneg( POW2, m );
+    } else if ( z >= 0 ) {
+        y += x >> I;
+        z -= POW2;
+    } else {
+        y -= x >> I;
+        z += POW2;
+    }
+}
+
+_SC_TEMPLATE
+template< uint32_t I > 
+inline void _SC::linear_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr T POW2 = ONE >> I;
+    if constexpr ( branchless ) {
+        const T m = -T(y >= 0);
+        y += cneg( x >> I, m );
+        z -= cneg( POW2, m );
+    } else if ( y < 0 ) {
+        y += x >> I;
+        z -= POW2;
+    } else {
+        y -= x >> I;
+        z += POW2;
+    }
+}
+
+//-----------------------------------------------------
+// Unrolled Step Sequences
+//-----------------------------------------------------
+_SC_TEMPLATE
+template< size_t... I > 
+inline void _SC::circular_rotation_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( circular_rotation_step<uint32_t(I)>( x, y, z ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... I > 
+inline void _SC::circular_vectoring_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( circular_vectoring_step<uint32_t(I)>( x, y, z ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... I > 
+inline void _SC::circular_vectoring_xy_steps( T& x, T& y, std::index_sequence<I...> )
+{
+    ( circular_vectoring_xy_step<uint32_t(I)>( x, y ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... S > 
+inline void _SC::hyperbolic_rotation_steps( T& x, T& y, T& z, std::index_sequence<S...> )
+{
+    ( hyperbolic_rotation_step<uint32_t(S)>( x, y, z ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... S > 
+inline void _SC::hyperbolic_vectoring_steps( T& x, T& y, T& z, std::index_sequence<S...> )
+{
+    ( hyperbolic_vectoring_step<uint32_t(S)>( x, y, z ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... S > 
+inline void _SC::hyperbolic_vectoring_xy_steps( T& x, T& y, std::index_sequence<S...> )
+{
+    ( hyperbolic_vectoring_xy_step<uint32_t(S)>( x, y ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... I > 
+inline void _SC::linear_rotation_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( linear_rotation_step<uint32_t(I)>( x, y, z ), ... );
+}
+
+_SC_TEMPLATE
+template< size_t... I > 
+inline void _SC::linear_vectoring_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( linear_vectoring_step<uint32_t(I)>( x, y, z ), ... );
+}
+
+//-----------------------------------------------------
+// The CORDIC Functions
+//-----------------------------------------------------
+_SC_TEMPLATE
+void _SC::circular_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -ONE                && x0 <= ONE,                "circular_rotation x0 must be in the range -1 .. 1" );
+    cassert( y0 >= -ONE                && y0 <= ONE,                "circular_rotation y0 must be in the range -1 .. 1" );
+    cassert( z0 >= -CIRCULAR_ANGLE_MAX && z0 <= CIRCULAR_ANGLE_MAX, "circular_rotation |z0| must be <= circular_angle_max (" +
+                                                                    this->to_string(CIRCULAR_ANGLE_MAX, true) + "), got z0=" + this->to_string(z0, true) );
+    x = x0;
+    y = y0;
+    z = z0;
+    circular_rotation_steps( x, y, z, std::make_index_sequence<N+1>() );
+}
+
+_SC_TEMPLATE
+void _SC::circular_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -3*ONE && x0 <= 3*ONE, "circular_vectoring x0 must be in the range -3 .. 3" );
+    cassert( y0 >= -ONE   && y0 <= ONE  , "circular_vectoring y0 must be in the range -1 .. 1" );
+    x = x0;
+    y = y0;
+    z = z0;
+    circular_vectoring_steps( x, y, z, std::make_index_sequence<N+1>() );
+}
+
+_SC_TEMPLATE
+void _SC::circular_vectoring_xy_unrolled( const T& x0, const T& y0, T& x, T& y ) const
+{
+    cassert( x0 >= -3*ONE && x0 <= 3*ONE, "circular_vectoring_xy x0 must be in the range -3 .. 3" );
+    cassert( y0 >= -ONE   && y0 <= ONE  , "circular_vectoring_xy y0 must be in the range -1 .. 1" );
+    x = x0;
+    y = y0;
+    circular_vectoring_xy_steps( x, y, std::make_index_sequence<N+1>() );
+}
+
+_SC_TEMPLATE
+void _SC::hyperbolic_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -2*ONE                && x0 <= 2*ONE,                "hyperbolic_rotation x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -2*ONE                && y0 <= 2*ONE,                "hyperbolic_rotation y0 must be in the range -2 .. 2" );
+    cassert( z0 >= -HYPERBOLIC_ANGLE_MAX && z0 <= HYPERBOLIC_ANGLE_MAX, "hyperbolic_rotation |z0| must be <= hyperbolic_angle_max (" + 
+                                                                        this->to_string(HYPERBOLIC_ANGLE_MAX, true) + "), got z0=" + this->to_string(z0, true) );
+    x = x0;
+    y = y0;
+    z = z0;
+    hyperbolic_rotation_steps( x, y, z, std::make_index_sequence<HYPERBOLIC_STEP_CNT>() );
+}
+
+_SC_TEMPLATE
+void _SC::hyperbolic_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -2*ONE && x0 <= 2*ONE, "hyperbolic_vectoring x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -2*ONE && y0 <= 2*ONE, "hyperbolic_vectoring y0 must be in the range -2 .. 2" );
+    x = x0;
+    y = y0;
+    z = z0;
+    hyperbolic_vectoring_steps( x, y, z, std::make_index_sequence<HYPERBOLIC_STEP_CNT>() );
+}
+
+_SC_TEMPLATE
+void _SC::hyperbolic_vectoring_xy_unrolled( const T& x0, const T& y0, T& x, T& y ) const
+{
+    cassert( x0 >= -2*ONE && x0 <= 2*ONE, "hyperbolic_vectoring_xy x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -2*ONE && y0 <= 2*ONE, "hyperbolic_vectoring_xy y0 must be in the range -2 .. 2" );
+    x = x0;
+    y = y0;
+    hyperbolic_vectoring_xy_steps( x, y, std::make_index_sequence<HYPERBOLIC_STEP_CNT>() );
+}
+
+_SC_TEMPLATE
+void _SC::linear_rotation_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -2*ONE && x0 <= 2*ONE, "linear_rotation x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -2*ONE && y0 <= 2*ONE, "linear_rotation y0 must be in the range -2 .. 2" );
+    x = x0;
+    y = y0;
+    z = z0;
+    linear_rotation_steps( x, y, z, std::make_index_sequence<N+1>() );
+}
+
+_SC_TEMPLATE
+void _SC::linear_vectoring_unrolled( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    cassert( x0 >= -2*ONE && x0 <= 2*ONE, "linear_vectoring x0 must be in the range -2 .. 2, got " + this->to_string(x0, true) );
+    cassert( y0 >= -2*ONE && y0 <= 2*ONE, "linear_vectoring y0 must be in the range -2 .. 2, got " + this->to_string(y0, true) );
+    x = x0;
+    y = y0;
+    z = z0;
+    linear_vectoring_steps( x, y, z, std::make_index_sequence<N+1>() );
+}
+
+#undef _SC_TEMPLATE
+#undef _SC
+
+#endif
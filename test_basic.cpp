@@ -24,9 +24,52 @@
 #include "Analysis.h"
 #include "AnalysisLight.h"
 #include "mpint.h"
+#include "StaticCordic.h"
 
 #include "test_helpers.h"                               // must be included after FLT is defined
 
+#include <sys/resource.h>
+
+// peak resident set size in KB
+//
+static long max_rss_kb( void )
+{
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;                      // bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+// StaticCordic must give the same answers as Cordic with the same format
+//
+template< typename SC >
+static void static_cordic_check( const char * name, const SC& sc, const Cordic<T,FLT>& c )
+{
+    for( uint32_t i = 0; i < 40; i++ )
+    {
+        const FLT xf = -4.0 + 0.2171*FLT(i);
+        const T   x  = c.to_t( xf );
+        const T   y  = c.to_t( 0.8104317980131708 );
+        const T   ax = c.abs( x );
+        cassert( sc.sin( x )       == c.sin( x ),       std::string( name ) + " sin mismatch" );
+        cassert( sc.cos( x )       == c.cos( x ),       std::string( name ) + " cos mismatch" );
+        cassert( sc.exp( x )       == c.exp( x ),       std::string( name ) + " exp mismatch" );
+        cassert( sc.tanh( x )      == c.tanh( x ),      std::string( name ) + " tanh mismatch" );
+        cassert( sc.mul( x, y )    == c.mul( x, y ),    std::string( name ) + " mul mismatch" );
+        cassert( sc.div( y, x )    == c.div( y, x ),    std::string( name ) + " div mismatch" );
+        cassert( sc.atan2( y, x )  == c.atan2( y, x ),  std::string( name ) + " atan2 mismatch" );
+        cassert( sc.hypot( x, y )  == c.hypot( x, y ),  std::string( name ) + " hypot mismatch" );
+        if ( !c.iszero( ax ) ) {
+            cassert( sc.log( ax )  == c.log( ax ),      std::string( name ) + " log mismatch" );
+            cassert( sc.sqrt( ax ) == c.sqrt( ax ),     std::string( name ) + " sqrt mismatch" );
+        }
+    }
+    std::cout << name << ": matches Cordic\n";
+}
+
 int main( int argc, const char * argv[] )
 {
     //---------------------------------------------------------------------------
@@ -37,6 +80,14 @@ int main( int argc, const char * argv[] )
     int  frac_w = 23;                           // same as float
     FLT  TOL = -1; 
     uint32_t loop_cnt = 2;                      
+    uint32_t radix = 2;
+    uint32_t lut_prefix = 0;
+    bool     linear_finish = false;
+    uint32_t hyperbolic_neg_iter = 0;
+    bool     small_angle_skip = false;
+    bool     early_exit = false;
+    bool     native_muldiv = false;
+    std::string div_engine = "CORDIC";
 
     for( int i = 1; i < argc; i++ )
     {
@@ -50,6 +101,22 @@ int main( int argc, const char * argv[] )
             TOL = std::atof( argv[++i] );
         } else if ( strcmp( argv[i], "-loop_cnt" ) == 0 ) {
             loop_cnt = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-radix" ) == 0 ) {
+            radix = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-linear_finish" ) == 0 ) {
+            linear_finish = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-hyperbolic_neg_iter" ) == 0 ) {
+            hyperbolic_neg_iter = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-small_angle_skip" ) == 0 ) {
+            small_angle_skip = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-early_exit" ) == 0 ) {
+            early_exit = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-native_muldiv" ) == 0 ) {
+            native_muldiv = std::atoi( argv[++i] );
+        } else if ( strcmp( argv[i], "-div_engine" ) == 0 ) {
+            div_engine = argv[++i];
+        } else if ( strcmp( argv[i], "-lut_prefix" ) == 0 ) {
+            lut_prefix = std::atoi( argv[++i] );
         } else if ( strcmp( argv[i], "-log" ) == 0 ) {
             Cordic<T,FLT>::logger_set( new Logger<T,FLT>( Cordic<T,FLT>::op_to_str, "" ) );
         } else if ( strcmp( argv[i], "-log_file" ) == 0 ) {
@@ -71,6 +138,23 @@ int main( int argc, const char * argv[] )
     //---------------------------------------------------------------------------
     freal::implicit_to_set( exp_or_int_w, frac_w, is_float );
     freal::implicit_from_set( true );
+    freal::implicit_to_get()->radix_set( radix );
+    freal::implicit_to_get()->lut_prefix_set( lut_prefix );
+    freal::implicit_to_get()->linear_finish_set( linear_finish );
+    freal::implicit_to_get()->hyperbolic_neg_iter_set( hyperbolic_neg_iter );
+    freal::implicit_to_get()->small_angle_skip_set( small_angle_skip );
+    freal::implicit_to_get()->early_exit_set( early_exit );
+    freal::implicit_to_get()->native_muldiv_set( native_muldiv );
+    using DIV_ENGINE = Cordic<T,FLT>::DIV_ENGINE;
+    const DIV_ENGINE div_engines[] = { DIV_ENGINE::CORDIC, DIV_ENGINE::SRT4, DIV_ENGINE::NEWTON, DIV_ENGINE::GOLDSCHMIDT };
+    for( auto e : div_engines )
+    {
+        if ( div_engine == Cordic<T,FLT>::to_str( e ) ) freal::implicit_to_get()->div_engine_set( e );
+    }
+    if ( div_engine != Cordic<T,FLT>::to_str( freal::implicit_to_get()->div_engine() ) ) {
+        std::cout << "ERROR: unknown -div_engine " << div_engine << "\n";
+        exit( 1 );
+    }
 
     //---------------------------------------------------------------------------
     // Run through all operations.
@@ -210,6 +294,500 @@ int main( int argc, const char * argv[] )
     do_op2(     "34) pow",              pow,    std::pow,      1.000000204890966415405273437500, 1.000229761004447937011718750000*8.0 );
     do_op12(    "35) sincos",           sincos, sincos,        1.000000204890966415405273437500 );
 
+    //---------------------------------------------------------------------------
+    // Batch routines must match the scalar ones bit-for-bit.
+    //---------------------------------------------------------------------------
+    std::cout << "\nBATCH:\n";
+    {
+        const Cordic<T,FLT> * cordic = freal::implicit_to_get();
+        static constexpr size_t cnt = 100;
+        T x[cnt];
+        T r[cnt];
+        T si[cnt];
+        T co[cnt];
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            x[i] = cordic->to_t( -10.0 + 0.20713*FLT(i) );
+            r[i] = cordic->to_t( 0.5 + 0.01*FLT(i) );
+        }
+        x[cnt/2] = cordic->zero();
+        x[1]     = cordic->to_t( 12345.678 );                   // wide reduction
+        x[2]     = cordic->to_t( -3.0e12 );                     // Payne-Hanek for sincos
+        x[3]     = cordic->to_t( 1.0e-20 );                     // tiny
+
+        for( uint32_t times_pi = 0; times_pi < 2; times_pi++ )
+        {
+            for( uint32_t with_r = 0; with_r < 2; with_r++ )
+            {
+                const T * rp = with_r ? r : nullptr;
+                if ( times_pi ) {
+                    cordic->sinpicospi_batch( x, si, co, cnt, rp );
+                } else {
+                    cordic->sincos_batch( x, si, co, cnt, rp );
+                }
+                for( size_t i = 0; i < cnt; i++ )
+                {
+                    T si1, co1;
+                    if ( times_pi ) {
+                        cordic->sinpicospi( x[i], si1, co1, with_r ? &r[i] : nullptr );
+                    } else {
+                        cordic->sincos( x[i], si1, co1, with_r ? &r[i] : nullptr );
+                    }
+                    cassert( si[i] == si1 && co[i] == co1, "batch sincos does not match scalar sincos for x=" + cordic->to_string( x[i] ) );
+                }
+                std::cout << (times_pi ? "sinpicospi_batch" : "sincos_batch") << (with_r ? "(r)" : "") << ": " << cnt << " values match\n";
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // Precomputed rotation directions must match circular_rotation() bit-for-bit.
+    //---------------------------------------------------------------------------
+    std::cout << "\nDIRS:\n";
+    {
+        Cordic<T,FLT> c( 8, 23, true );
+        const T xy0[][2] = { { c.to_t( 0.607252935008881, false, true ), 0                             },
+                             { c.to_t( 0.5,               false, true ), c.to_t(  0.25,  false, true ) },
+                             { c.to_t( -0.125,            false, true ), c.to_t(  0.999, false, true ) } };
+        static constexpr size_t cnt = 201;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T z0 = c.to_t( (-0.78 + 1.56*FLT(i)/FLT(cnt-1)), false, true );
+            const uint64_t dirs = c.circular_rotation_dirs( z0 );
+            for( const auto& p : xy0 )
+            {
+                T x1, y1, z1, x2, y2;
+                c.circular_rotation( p[0], p[1], z0, x1, y1, z1 );
+                c.circular_rotation_xy( p[0], p[1], dirs, x2, y2 );
+                cassert( x1 == x2 && y1 == y2, "circular_rotation_xy does not match circular_rotation for z0=" + c.to_string( z0, true ) );
+            }
+        }
+        std::cout << "circular_rotation_dirs/xy: " << cnt << " angles match\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Division/sqrt engines.  All but CORDIC end with an exact remainder, so
+    // div and sqrt must match native_muldiv and each other bit-for-bit.
+    //---------------------------------------------------------------------------
+    std::cout << "\nDIV ENGINES:\n";
+    {
+        Cordic<T,FLT> ref( 8, 23, true );
+        ref.native_muldiv_set( true );
+        ref.div_engine_set( DIV_ENGINE::SRT4 );
+        for( auto e : div_engines )
+        {
+            Cordic<T,FLT> c( 8, 23, true );
+            c.div_engine_set( e );
+            const bool is_exact = e != DIV_ENGINE::CORDIC;
+            static constexpr size_t cnt = 200;
+            for( size_t i = 0; i < cnt; i++ )
+            {
+                const T y = c.to_t( 0.001 + 3.7*FLT(i) );
+                const T x = c.to_t( -7.3 + 0.0731*FLT(i) + 0.00001 );
+                const T q = c.div( y, x );
+                const T r = c.sqrt( y );
+                const FLT rs = c.to_flt( c.rsqrt( y ) );
+                const FLT yf = c.to_flt( y );
+                cassert( !is_exact || q == ref.div( y, x ), c.to_str( e ) + " div does not match for y=" + c.to_string( y ) + " x=" + c.to_string( x ) );
+                cassert( !is_exact || r == ref.sqrt( y ),   c.to_str( e ) + " sqrt does not match for y=" + c.to_string( y ) );
+                cassert( std::abs( rs - 1.0/std::sqrt( yf ) ) <= TOL / std::sqrt( yf ), c.to_str( e ) + " rsqrt outside tolerance for y=" + c.to_string( y ) );
+            }
+            std::cout << std::setw( 12 ) << c.to_str( e ) << ": " << std::setw( 2 ) << c.div_engine_steps() << " steps per divide, " <<
+                         std::setw( 2 ) << c.div_engine_sqrt_steps() << " per sqrt, " << cnt << " values " << 
+                         (is_exact ? "match" : "within tolerance") << "\n";
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // r folded into the rotation must scale both outputs.
+    //---------------------------------------------------------------------------
+    std::cout << "\nRADIUS:\n";
+    {
+        const Cordic<T,FLT> * cordic = freal::implicit_to_get();
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic->to_t( -4.0 + 0.0811*FLT(i) );
+            const T   r  = cordic->to_t( ((i & 1) ? -1.0 : 1.0) * (0.3 + 0.173*FLT(i)) );
+            const FLT xr = cordic->to_flt( x );
+            const FLT rr = cordic->to_flt( r );
+            T si, co, sih, coh;
+            cordic->sincos( x, si, co, &r );
+            cordic->sinhcosh( x, sih, coh, &r );
+            const FLT tol = TOL * std::abs( rr );
+            cassert( std::abs( cordic->to_flt( si ) - rr*std::sin( xr ) ) <= tol, "sincos(r) outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic->to_flt( co ) - rr*std::cos( xr ) ) <= tol, "sincos(r) outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic->to_flt( sih ) - rr*std::sinh( xr ) ) <= tol*std::cosh( xr ), "sinhcosh(r) outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic->to_flt( coh ) - rr*std::cosh( xr ) ) <= tol*std::cosh( xr ), "sinhcosh(r) outside tolerance for x=" + std::to_string( xr ) );
+        }
+        std::cout << "sincos(r)/sinhcosh(r): " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // cbrt/rcbrt keep the sign of x; rsqrt/cbrt/rcbrt cover a wide exponent range.
+    //---------------------------------------------------------------------------
+    std::cout << "\nROOTS:\n";
+    {
+        const Cordic<T,FLT> * cordic = freal::implicit_to_get();
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const FLT xf = std::ldexp( 1.0 + 0.00937*FLT(i), int(i % 25) - 12 );
+            const T   x  = cordic->to_t( xf );
+            const FLT xr = cordic->to_flt( x );
+            const FLT cb = cordic->to_flt( cordic->cbrt( cordic->neg( x ) ) );
+            const FLT rc = cordic->to_flt( cordic->rcbrt( cordic->neg( x ) ) );
+            const FLT rs = cordic->to_flt( cordic->rsqrt( x ) );
+            cassert( std::abs( cb + std::cbrt( xr ) )      <= TOL * std::cbrt( xr ),      "cbrt outside tolerance for x=-" + std::to_string( xr ) );
+            cassert( std::abs( rc + 1.0/std::cbrt( xr ) )  <= TOL / std::cbrt( xr ),      "rcbrt outside tolerance for x=-" + std::to_string( xr ) );
+            cassert( std::abs( rs - 1.0/std::sqrt( xr ) )  <= TOL / std::sqrt( xr ),      "rsqrt outside tolerance for x=" + std::to_string( xr ) );
+        }
+        std::cout << "cbrt/rcbrt/rsqrt: " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Negative hyperbolic iterations let exp/sinh/cosh skip argument reduction.
+    //---------------------------------------------------------------------------
+    std::cout << "\nHYPERBOLIC NEG ITER:\n";
+    if ( is_float ) {
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w );
+        cordic.hyperbolic_neg_iter_set( 4 );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic.to_t( -7.0 + 0.1413*FLT(i) );
+            const FLT xr = cordic.to_flt( x );
+            const FLT ex = cordic.to_flt( cordic.exp( x ) );
+            const FLT sh = cordic.to_flt( cordic.sinh( x ) );
+            const FLT ch = cordic.to_flt( cordic.cosh( x ) );
+            cassert( std::abs( ex - std::exp( xr ) )  <= TOL * std::exp( xr ),  "exp outside tolerance for x="  + std::to_string( xr ) );
+            cassert( std::abs( sh - std::sinh( xr ) ) <= TOL * std::cosh( xr ), "sinh outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( ch - std::cosh( xr ) ) <= TOL * std::cosh( xr ), "cosh outside tolerance for x=" + std::to_string( xr ) );
+        }
+        std::cout << "exp/sinh/cosh with 4 negative iterations: " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Small angles start past the iterations they don't need.
+    //---------------------------------------------------------------------------
+    std::cout << "\nSMALL ANGLE SKIP:\n";
+    {
+        const Cordic<T,FLT> * dflt = freal::implicit_to_get();
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        cordic.small_angle_skip_set( true );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic.to_t( ((i & 1) ? -1.0 : 1.0) * std::ldexp( 1.0 + 0.0137*FLT(i), -int(i % 16) ) );
+            const FLT xr = cordic.to_flt( x );
+            const FLT tol = TOL * std::max( std::abs( xr ), FLT(1.0/16.0) );     // core routines have absolute error
+            cassert( std::abs( cordic.to_flt( cordic.sin( x ) )  - dflt->to_flt( dflt->sin( x ) ) )  <= tol, "sin outside tolerance for x="  + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.cos( x ) )  - dflt->to_flt( dflt->cos( x ) ) )  <= TOL, "cos outside tolerance for x="  + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.sinh( x ) ) - dflt->to_flt( dflt->sinh( x ) ) ) <= tol, "sinh outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.atan( x ) ) - dflt->to_flt( dflt->atan( x ) ) ) <= tol, "atan outside tolerance for x=" + std::to_string( xr ) );
+        }
+        std::cout << "sin/cos/sinh/atan: " << cnt << " small values match default mode within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Exact inputs stop the core loops early; the logger counts what was saved.
+    //---------------------------------------------------------------------------
+    std::cout << "\nEARLY EXIT:\n";
+    {
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        cordic.early_exit_set( true );
+        Logger<T,FLT> * prev_logger = Cordic<T,FLT>::logger_get();
+        Logger<T,FLT>   counter( Cordic<T,FLT>::op_to_str, "counter" );     // non-empty file name means no text output
+        Cordic<T,FLT>::logger_set( &counter );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x    = cordic.to_t( 1.0 + FLT(i)/128.0 );                 // few mantissa bits, so y reaches 0
+            const FLT xr   = cordic.to_flt( x );
+            const T   pow2 = cordic.to_t( std::ldexp( 1.0, int(i % 4) ) );
+            const FLT q    = cordic.to_flt( cordic.div( x, pow2 ) );
+            const FLT h    = cordic.to_flt( cordic.hypot( x, cordic.to_t( 0.0 ) ) );
+            const FLT a    = cordic.to_flt( cordic.atan2( cordic.to_t( 0.0 ), x ) );
+            cassert( q == xr / std::ldexp( 1.0, int(i % 4) ), "div by power of 2 not exact for x=" + std::to_string( xr ) );
+            cassert( std::abs( h - xr ) <= TOL * xr,           "hypot(x,0) outside tolerance for x=" + std::to_string( xr ) );
+            cassert( a == 0.0,                                 "atan2(0,x) not 0 for x=" + std::to_string( xr ) );
+        }
+        Cordic<T,FLT>::logger_set( prev_logger );
+        cassert( counter.iterations_skipped_cnt() != 0, "early exit skipped no iterations" );
+        std::cout << "div/hypot/atan2: " << cnt << " exact inputs ok, " << counter.iterations_skipped_cnt() << " iterations skipped\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Per-function iteration counts found by calibration.
+    //---------------------------------------------------------------------------
+    std::cout << "\nN FOR:\n";
+    {
+        using OP = typename Cordic<T,FLT>::OP;
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        static constexpr size_t cnt = 64;
+        FLT xs[cnt];
+        FLT ys[cnt];
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            xs[i] = 0.1 + 0.0217*FLT(i);
+            ys[i] = 0.5 + 0.0233*FLT(i);
+        }
+        for( OP op : { OP::sin, OP::exp, OP::log, OP::div, OP::sqrt, OP::atan2 } )
+        {
+            const uint32_t n = cordic.n_for_calibrate( op, 2.0, xs, cnt, ys );
+            cassert( n == cordic.n_for( op ), "n_for_calibrate did not set n_for" );
+            std::cout << Cordic<T,FLT>::op_to_str( uint16_t(op) ) << ": n=" << n << "\n";
+        }
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic.to_t( xs[i] );
+            const FLT xr = cordic.to_flt( x );
+            cassert( std::abs( cordic.to_flt( cordic.sin( x ) ) - std::sin( xr ) ) <= TOL, "sin outside tolerance after calibration for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.exp( x ) ) - std::exp( xr ) ) <= TOL * std::exp( xr ), "exp outside tolerance after calibration for x=" + std::to_string( xr ) );
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // Full-table lookup for a 16-bit format must match the CORDIC path bit for bit.
+    // The ranges avoid inputs the CORDIC path does not take in such a small format.
+    //---------------------------------------------------------------------------
+    std::cout << "\nLOOKUP:\n";
+    {
+        using OP = typename Cordic<T,FLT>::OP;
+        struct Range { OP op; FLT abs_min; FLT abs_max; };
+        const Range ranges[] = { { OP::sqrt, 0.0,        INFINITY }, 
+                                 { OP::exp,  1.0/1024.0, 8.0      }, 
+                                 { OP::log,  1.0/1024.0, INFINITY },
+                                 { OP::sin,  1.0/256.0,  64.0     },
+                                 { OP::atan, 0.0,        INFINITY } };
+        Cordic<T,FLT> plain( 5, 10 );
+        Cordic<T,FLT> cordic( 5, 10 );
+        for( const Range& r : ranges ) cordic.lookup_tables_build( { r.op }, r.abs_min, r.abs_max );
+        const std::string file_name = "test_basic_lookup.tbl";
+        cassert( cordic.lookup_tables_save( file_name ), "could not save lookup tables to " + file_name );
+        Cordic<T,FLT> loaded( 5, 10 );
+        cassert( loaded.lookup_tables_load( file_name ), "could not load lookup tables from " + file_name );
+        std::remove( file_name.c_str() );
+        cassert( !loaded.lookup_tables_load( file_name ), "loaded lookup tables from a missing file" );
+        const size_t cnt = size_t(1) << (plain.w() - plain.guard_w());
+        for( const Range& range : ranges )
+        {
+            const OP          op      = range.op;
+            const std::string op_name = Cordic<T,FLT>::op_to_str( uint16_t(op) );
+            cassert( cordic.lookup_table_has( op ) && loaded.lookup_table_has( op ), "lookup table missing for " + op_name );
+            size_t match_cnt = 0;
+            for( size_t i = 0; i < cnt; i++ )
+            {
+                const T   x  = T(i) << plain.guard_w();
+                const FLT ax = std::abs( plain.to_flt( x ) );
+                if ( !plain.isfinite( x ) || ax < range.abs_min || ax > range.abs_max ) continue;
+                T r, rt, rl;
+                switch( op )
+                {
+                    case OP::sqrt: r = plain.sqrt( x ); rt = cordic.sqrt( x ); rl = loaded.sqrt( x ); break;
+                    case OP::exp:  r = plain.exp( x );  rt = cordic.exp( x );  rl = loaded.exp( x );  break;
+                    case OP::log:  r = plain.log( x );  rt = cordic.log( x );  rl = loaded.log( x );  break;
+                    case OP::sin:  r = plain.sin( x );  rt = cordic.sin( x );  rl = loaded.sin( x );  break;
+                    default:       r = plain.atan( x ); rt = cordic.atan( x ); rl = loaded.atan( x ); break;
+                }
+                cassert( rt == r && rl == r, op_name + " lookup differs from CORDIC for encoding " + std::to_string( i ) );
+                match_cnt++;
+            }
+            std::cout << op_name << ": " << match_cnt << " encodings match\n";
+        }
+
+        // a mode change makes the tables stale, so results follow the new mode
+        plain.n_for_set(  OP::sqrt, (plain.n()+1)/2 );
+        cordic.n_for_set( OP::sqrt, (plain.n()+1)/2 );
+        size_t stale_cnt = 0;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T x = T(i) << plain.guard_w();
+            if ( !plain.isfinite( x ) || plain.signbit( x ) ) continue;
+            cassert( cordic.sqrt( x ) == plain.sqrt( x ), "stale sqrt lookup table used for encoding " + std::to_string( i ) );
+            stale_cnt++;
+        }
+        std::cout << "sqrt: " << stale_cnt << " encodings follow n_for_set() after the build\n";
+        cordic.lookup_tables_clear();
+        cassert( !cordic.lookup_table_has( OP::sqrt ), "lookup_tables_clear left a table" );
+    }
+
+    //---------------------------------------------------------------------------
+    // Memo cache: repeated operands hit, results match an uncached Cordic exactly.
+    //---------------------------------------------------------------------------
+    std::cout << "\nMEMO CACHE:\n";
+    {
+        Cordic<T,FLT> plain( exp_or_int_w, frac_w, is_float );
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        cordic.memo_cache_set( 64 );
+        Logger<T,FLT> * prev_logger = Cordic<T,FLT>::logger_get();
+        Logger<T,FLT>   counter( Cordic<T,FLT>::op_to_str, "counter" );     // non-empty file name means no text output
+        Cordic<T,FLT>::logger_set( &counter );
+        static constexpr size_t val_cnt   = 16;
+        static constexpr size_t round_cnt = 8;
+        for( size_t k = 0; k < round_cnt; k++ )
+        {
+            for( size_t i = 0; i < val_cnt; i++ )
+            {
+                const T x = cordic.to_t( 0.25 + 0.1379*FLT(i) );
+                const T y = cordic.to_t( 1.5 + 0.0611*FLT(i) );
+                cassert( cordic.sin( x ) == plain.sin( x ),       "memo sin differs for i=" + std::to_string( i ) );
+                cassert( cordic.log( y ) == plain.log( y ),       "memo log differs for i=" + std::to_string( i ) );
+                cassert( cordic.div( x, y ) == plain.div( x, y ), "memo div differs for i=" + std::to_string( i ) );
+            }
+        }
+        Cordic<T,FLT>::logger_set( prev_logger );
+        const uint64_t hit_cnt  = cordic.memo_cache_hit_cnt();
+        const uint64_t miss_cnt = cordic.memo_cache_miss_cnt();
+        cassert( hit_cnt + miss_cnt == 3 * val_cnt * round_cnt, "memo cache did not see every outermost call" );
+        cassert( miss_cnt < 3 * val_cnt * 2,                    "memo cache missed too often" );
+        cassert( counter.memo_hit_cnt() == hit_cnt && counter.memo_miss_cnt() == miss_cnt, "logger memo counts differ from Cordic's" );
+        std::cout << "sin/log/div: " << hit_cnt << " hits, " << miss_cnt << " misses\n";
+
+        std::vector<std::thread> threads;
+        for( uint32_t t = 0; t < 4; t++ )
+        {
+            threads.push_back( std::thread( [&cordic, &plain, t]( void ) 
+            {
+                for( size_t i = 0; i < 64; i++ )
+                {
+                    const T x = cordic.to_t( 0.125 * FLT((i + t) % 8) );
+                    cassert( cordic.cos( x ) == plain.cos( x ), "memo cos differs in thread " + std::to_string( t ) );
+                }
+            } ) );
+        }
+        for( auto& th: threads ) th.join();
+        cassert( cordic.memo_cache_hit_cnt() + cordic.memo_cache_miss_cnt() == hit_cnt + miss_cnt + 4*64, "memo counts lost across threads" );
+        std::cout << "cos on 4 threads: " << (cordic.memo_cache_hit_cnt() - hit_cnt) << " hits\n";
+
+        // destroyed Cordics must release their caches on every thread that used them
+        static constexpr size_t life_cnt = 500;
+        const long rss_before = max_rss_kb();
+        for( size_t i = 0; i < life_cnt; i++ )
+        {
+            Cordic<T,FLT> c( exp_or_int_w, frac_w, is_float );
+            c.memo_cache_set( 64 );
+            const T x = c.to_t( 0.3 + 0.001*FLT(i) );
+            const T s = c.sin( x );
+            std::thread th( [&c, x, s]( void ) { cassert( c.sin( x ) == s, "memo sin differs in thread" ); } );
+            th.join();
+            cassert( c.sin( x ) == s && c.memo_cache_hit_cnt() == 1, "memo sin did not hit after construction" );
+        }
+        const long rss_growth_kb = max_rss_kb() - rss_before;
+        cassert( rss_growth_kb < 16*1024, "memo caches of destroyed Cordics were not freed, max RSS grew by " + std::to_string( rss_growth_kb ) + " KB" );
+        std::cout << life_cnt << " memo-enabled Cordics constructed and destroyed, max RSS grew by " << rss_growth_kb << " KB\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // log2/log10/exp2/exp10 through the base-scaled atanh tables.
+    //---------------------------------------------------------------------------
+    std::cout << "\nBASE SCALED:\n";
+    {
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic.to_t( 0.05 + 0.0371*FLT(i) );
+            const FLT xr = cordic.to_flt( x );
+            const T   e  = cordic.to_t( -2.0 + 0.0391*FLT(i) );
+            const FLT er = cordic.to_flt( e );
+            cassert( std::abs( cordic.to_flt( cordic.log2( x ) )  - std::log2( xr ) )  <= TOL, "log2 outside tolerance for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.log10( x ) ) - std::log10( xr ) ) <= TOL, "log10 outside tolerance for x=" + std::to_string( xr ) );
+            cassert( cordic.logc( x, 2.0 ) == cordic.log2( x ),                                 "logc(x,2) differs from log2 for x=" + std::to_string( xr ) );
+            cassert( std::abs( cordic.to_flt( cordic.exp2( e ) )  - std::exp2( er ) ) <= TOL * std::exp2( er ), 
+                     "exp2 outside tolerance for x=" + std::to_string( er ) );
+            cassert( std::abs( cordic.to_flt( cordic.exp10( e ) ) - std::pow( 10.0, er ) ) <= TOL * std::pow( 10.0, er ), 
+                     "exp10 outside tolerance for x=" + std::to_string( er ) );
+        }
+        std::cout << "log2/log10/exp2/exp10: " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // pow() with integer exponents goes through repeated squaring.
+    //---------------------------------------------------------------------------
+    std::cout << "\nPOW INT:\n";
+    {
+        Cordic<T,FLT> native( exp_or_int_w, frac_w, is_float );
+        native.native_muldiv_set( true );
+        cassert( native.to_flt( native.pow( native.to_t( 2.0 ),  native.to_t( 3.0 ) ) )  == 8.0,   "pow(2,3) != 8" );
+        cassert( native.to_flt( native.pow( native.to_t( -2.0 ), native.to_t( 3.0 ) ) )  == -8.0,  "pow(-2,3) != -8" );
+        cassert( native.to_flt( native.pow( native.to_t( -2.0 ), native.to_t( -2.0 ) ) ) == 0.25,  "pow(-2,-2) != 0.25" );
+        cassert( native.to_flt( native.pow( native.to_t( 1.5 ),  native.to_t( 0.0 ) ) )  == 1.0,   "pow(1.5,0) != 1" );
+
+        Cordic<T,FLT> cordic( exp_or_int_w, frac_w, is_float );
+        cassert( cordic.pow( cordic.to_t( 1.5 ), cordic.to_t( 1.0 ) ) == cordic.to_t( 1.5 ), "pow(1.5,1) != 1.5" );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   b  = cordic.to_t( ((i & 1) ? -1.0 : 1.0) * (0.5 + 0.01*FLT(i)) );
+            const FLT br = cordic.to_flt( b );
+            for( int k = -3; k <= 3; k++ )
+            {
+                const FLT ref = std::pow( br, FLT(k) );
+                cassert( std::abs( cordic.to_flt( cordic.pow( b, cordic.to_t( FLT(k) ) ) ) - ref ) <= TOL * std::max( FLT(1), std::abs( ref ) ),
+                         "pow outside tolerance for b=" + std::to_string( br ) + " k=" + std::to_string( k ) );
+            }
+            const FLT ref = std::pow( std::abs( br ), FLT(1.5) );
+            cassert( std::abs( cordic.to_flt( cordic.pow( cordic.abs( b ), cordic.to_t( 1.5 ) ) ) - ref ) <= TOL * std::max( FLT(1), ref ),
+                     "pow outside tolerance for b=" + std::to_string( br ) + " x=1.5" );
+        }
+        std::cout << "pow(b,-3..3) and pow(|b|,1.5): " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // User constant multipliers.
+    //---------------------------------------------------------------------------
+    std::cout << "\nCONST:\n";
+    {
+        const Cordic<T,FLT> * cordic = freal::implicit_to_get();
+        const FLT cf = -0.7853981633974483 * 1.2345;
+        const auto cm = cordic->make_const_multiplier( cf );
+        const FLT cr = cordic->to_flt( cordic->to_t( cf ) );
+        static constexpr size_t cnt = 100;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const T   x  = cordic->to_t( -3.0 + 0.0617*FLT(i) );
+            const FLT xr = cordic->to_flt( x );
+            const FLT r  = cordic->to_flt( cordic->mulc( x, cm ) );
+            cassert( std::abs( r - xr*cr ) <= TOL * std::max( FLT(1), std::abs( xr*cr ) ), "mulc outside tolerance for x=" + std::to_string( xr ) );
+        }
+        std::cout << "mulc: " << cm.digits.size() << " CSD digits, " << cnt << " values within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Large sin/cos arguments go through Payne-Hanek reduction.
+    //---------------------------------------------------------------------------
+    std::cout << "\nLARGE:\n";
+    if ( is_float ) {
+        const Cordic<T,FLT> * cordic = freal::implicit_to_get();
+        static constexpr size_t cnt = 200;
+        for( size_t i = 0; i < cnt; i++ )
+        {
+            const FLT xf = ((i & 1) ? -1.0 : 1.0) * std::pow( FLT(1.31), FLT(i % 100) ) * (1.0 + 0.0173*FLT(i));
+            const T   x  = cordic->to_t( xf );
+            if ( cordic->isinf( x ) ) continue;                       // small formats
+            const FLT xr = cordic->to_flt( x );
+            T si, co;
+            cordic->sincos( x, si, co );
+            cassert( std::abs( cordic->to_flt( si ) - std::sin( xr ) ) <= TOL &&
+                     std::abs( cordic->to_flt( co ) - std::cos( xr ) ) <= TOL, "sincos outside tolerance for large x=" + std::to_string( xr ) );
+        }
+        std::cout << "sincos: " << cnt << " large arguments within tolerance\n";
+    }
+
+    //---------------------------------------------------------------------------
+    // Compile-time formats.
+    //---------------------------------------------------------------------------
+    std::cout << "\nSTATIC:\n";
+    {
+        StaticCordic<T, 8, 23, true> sc;
+        Cordic<T,FLT>                c( 8, 23, true );
+        static_cordic_check( "StaticCordic<T,8,23,true>", sc, c );
+        sc.radix_set( 4 );                              // back to the Cordic loops
+        c.radix_set( 4 );
+        static_cordic_check( "StaticCordic<T,8,23,true> radix 4", sc, c );
+    }
+
     std::cout << "PASSED\n";
     return 0;
 }